@@ -0,0 +1,98 @@
+//Times conversions of integers which fit in 64 and 128 bits, such as IDs, timestamps and hashes, which take the native fast path,
+//against the same conversions made with the big integer parser and formatter.
+//Build with e.g. g++ -std=c++17 -O2 -I../src SmallIntegerBenchmark.cpp -o SmallIntegerBenchmark
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "AnyBaseConversion.h"
+
+namespace
+{
+        //Random numbers with up to a given number of digits in a base.
+        std::vector<std::string> make_numbers(const AnyBaseConversion::Alphabet &alphabet, size_t digits, size_t count)
+        {
+                std::mt19937_64 random {12345};
+                std::vector<std::string> numbers;
+                for (size_t i {0}; i < count; i++)
+                {
+                        std::string number(digits, static_cast<char>(alphabet.get_digit(0)));
+                        for (char &digit : number)
+                                digit = static_cast<char>(alphabet.get_digit(random() % alphabet.get_base()));
+                        numbers.push_back(number);
+                }
+                return numbers;
+        }
+
+        //Returns the nanoseconds per call of a function of each number.
+        template <typename Function>
+        double time_per_call(const std::vector<std::string> &numbers, size_t repeats, Function function)
+        {
+                auto start = std::chrono::steady_clock::now();
+                for (size_t repeat {0}; repeat < repeats; repeat++)
+                        for (const std::string &number : numbers)
+                                function(number);
+                std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+                return elapsed.count() / static_cast<double>(numbers.size() * repeats);
+        }
+
+        //Converts with BaseConversion::convert_into, which takes the native fast path for these numbers.
+        double time_fast_path(const std::vector<std::string> &numbers, const AnyBaseConversion::Alphabet &input_alphabet, const AnyBaseConversion::Alphabet &output_alphabet, size_t &checksum)
+        {
+                AnyBaseConversion::BaseConversion converter {};
+                char output[256];
+                return time_per_call(numbers, 20, [&](const std::string &number)
+                {
+                        converter.input(number, input_alphabet);
+                        checksum += converter.convert_into(output, sizeof(output), output_alphabet).characters_written;
+                });
+        }
+
+        //Converts the same digits with the big integer parser and formatter.
+        double time_big_integer_path(const std::vector<std::string> &numbers, const AnyBaseConversion::Alphabet &input_alphabet, const AnyBaseConversion::Alphabet &output_alphabet, size_t &checksum)
+        {
+                std::pmr::vector<AnyBaseConversion::NarrowDigitValue> digit_values;
+                AnyBaseConversion::BasicOutputBuffer<char> output_buffer;
+                return time_per_call(numbers, 20, [&](const std::string &number)
+                {
+                        digit_values.clear();
+                        for (char digit : number)
+                                digit_values.push_back(static_cast<AnyBaseConversion::NarrowDigitValue>(input_alphabet.get_digit_value(static_cast<wchar_t>(digit))));
+                        boost::multiprecision::cpp_int num = AnyBaseConversion::convert_digit_values_to_integer(digit_values, 0, digit_values.size(), input_alphabet.get_base());
+                        output_buffer.reset(AnyBaseConversion::estimate_number_of_digits(num, output_alphabet.get_base()), 0);
+                        AnyBaseConversion::write_integer(num, output_alphabet, output_buffer);
+                        checksum += output_buffer.size();
+                });
+        }
+}
+
+int main()
+{
+        struct Case
+        {
+                const char              *name;
+                AnyBaseConversion::Base input_base;
+                AnyBaseConversion::Base output_base;
+                size_t                  digits;
+        };
+        const Case cases[] = {
+                {"64-bit decimal to base58", AnyBaseConversion::decimal, AnyBaseConversion::base58, 19},
+                {"64-bit decimal to hexadecimal", AnyBaseConversion::decimal, AnyBaseConversion::hexadecimal, 19},
+                {"64-bit hexadecimal to decimal", AnyBaseConversion::hexadecimal, AnyBaseConversion::decimal, 16},
+                {"124-bit hexadecimal to base36", AnyBaseConversion::hexadecimal, AnyBaseConversion::base36, 31},
+                {"128-bit decimal to base58", AnyBaseConversion::decimal, AnyBaseConversion::base58, 38},
+        };
+        size_t checksum {0};
+        for (const Case &c : cases)
+        {
+                const AnyBaseConversion::Alphabet &input_alphabet = AnyBaseConversion::get_alphabet_from_base(c.input_base);
+                const AnyBaseConversion::Alphabet &output_alphabet = AnyBaseConversion::get_alphabet_from_base(c.output_base);
+                std::vector<std::string> numbers = make_numbers(input_alphabet, c.digits, 10000);
+                double fast = time_fast_path(numbers, input_alphabet, output_alphabet, checksum);
+                double big = time_big_integer_path(numbers, input_alphabet, output_alphabet, checksum);
+                std::cout << c.name << ": " << fast << " ns per conversion, " << big << " ns with big integers (" << big / fast << "x)" << std::endl;
+        }
+        std::cout << "Checksum: " << checksum << std::endl;
+        return 0;
+}
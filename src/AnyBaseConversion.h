@@ -2,6 +2,8 @@
 #define ANYBASECONVERSION_H_INCLUDED
 
 #include <string>
+#include <string_view>
+#include <vector>
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
@@ -9,13 +11,30 @@
 #include <locale>
 #include <cstdint>
 #include <cwchar>
+#include <cwctype>
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include <numeric>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include <mutex>
+#include <shared_mutex>
 #include <locale.h>
 #include <boost/multiprecision/cpp_int.hpp>
-#include <boost/multiprecision/cpp_dec_float.hpp>
 #include <boost/container/flat_map.hpp>
 
 //User-definable constants.
 constexpr size_t        float_precision_default {10}; //Return of floats defaults to this number of decimal places, or more if the user manually requests a higher precision.
+constexpr size_t        divide_and_conquer_parse_threshold {256}; //Digit strings longer than this are parsed by splitting them in half, rather than one digit at a time.
+constexpr size_t        divide_and_conquer_format_threshold {256}; //Integers with more digits than this are formatted by splitting them in half, rather than one digit at a time.
+constexpr size_t        power_cache_memory_limit_default {64 * 1024 * 1024}; //Default memory budget, in bytes, of the process-wide cache of powers of bases. Can be changed at run time with PowerCache::set_memory_limit.
+constexpr size_t        repetend_length_limit {65536}; //With repetend detection, floats whose repeating digits are longer than this are rounded to the precision instead, with a warning.
 
 
 namespace AnyBaseConversion
@@ -48,78 +67,101 @@ namespace AnyBaseConversion
 
         struct BaseInformation
         {
-                std::string             name; //The name of the base as a string.
+                std::string_view        name; //The name of the base.
                 AnyBaseConversion::Base base; //The AnyBaseConversion::Base enum of the base.
-                std::string             digits; //String defining the digits in the base. Digits are in order and are all distinct.
+                std::string_view        digits; //String defining the digits in the base. Digits are in order and are all distinct.
                 bool                    conversion_to_upper_case; //Bases with definitions that include only lower-case letters can also be input/output as upper-case. E.g. hexadecimal can be equally represented "0123456789abcdef" or "0123456789ABCDEF".
+                size_t                  size; //The number of digits.
+                bool                    is_power_of_two; //Whether the number of digits is a power of two, so that it can be bit sliced to and from any other such base.
         };
 
-        std::vector<AnyBaseConversion::BaseInformation> base_information_vector {
-                {"binary",              AnyBaseConversion::binary,              "01",                                                                   false},
-                {"ternary",             AnyBaseConversion::ternary,             "012",                                                                  false},
-                {"quaternary",          AnyBaseConversion::quaternary,          "0123",                                                                 false},
-                {"quinary",             AnyBaseConversion::quinary,             "01234",                                                                false},
-                {"senary",              AnyBaseConversion::senary,              "012345",                                                               false},
-                {"septenary",           AnyBaseConversion::septenary,           "0123456",                                                              false},
-                {"octal",               AnyBaseConversion::octal,               "01234567",                                                             false},
-                {"nonary",              AnyBaseConversion::nonary,              "012345678",                                                            false},
-                {"decimal",             AnyBaseConversion::decimal,             "0123456789",                                                           false},
-                {"undecimal",           AnyBaseConversion::undecimal,           "0123456789a",                                                          true},
-                {"duodecimal",          AnyBaseConversion::duodecimal,          "0123456789ab",                                                         true},
-                {"docenal",             AnyBaseConversion::docenal,             "0123456789ab",                                                         true},
-                {"tridecimal",          AnyBaseConversion::tridecimal,          "0123456789abc",                                                        true},
-                {"tetradecimal",        AnyBaseConversion::tetradecimal,        "0123456789abcd",                                                       true},
-                {"pentadecimal",        AnyBaseConversion::pentadecimal,        "0123456789abcde",                                                      true},
-                {"hexadecimal",         AnyBaseConversion::hexadecimal,         "0123456789abcdef",                                                     true},
-                {"vigesimal",           AnyBaseConversion::vigesimal,           "0123456789abcdefghjk",                                                 true},
-                {"tetravigesimal",      AnyBaseConversion::tetravigesimal,      "0123456789abcdefghjkmnpq",                                             true},
-                {"base32",              AnyBaseConversion::base32,              "abcdefghijklmnopqrstuvwxyz234567",                                     true},
-                {"base36",              AnyBaseConversion::base36,              "0123456789abcdefghijklmnopqrstuvwxyz",                                 true},
-                {"base58",              AnyBaseConversion::base58,              "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz",           false},
-                {"base64",              AnyBaseConversion::base64,              "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",     false}
-        };
+        //The defined bases, indexed by their Base enum. Constant-initialized, so it costs nothing at startup, and it can be iterated over to enumerate the bases.
+        inline constexpr std::array<BaseInformation, 22> base_information {{
+                {"binary",              AnyBaseConversion::binary,              "01",                                                                   false,  2,      true},
+                {"ternary",             AnyBaseConversion::ternary,             "012",                                                                  false,  3,      false},
+                {"quaternary",          AnyBaseConversion::quaternary,          "0123",                                                                 false,  4,      true},
+                {"quinary",             AnyBaseConversion::quinary,             "01234",                                                                false,  5,      false},
+                {"senary",              AnyBaseConversion::senary,              "012345",                                                               false,  6,      false},
+                {"septenary",           AnyBaseConversion::septenary,           "0123456",                                                              false,  7,      false},
+                {"octal",               AnyBaseConversion::octal,               "01234567",                                                             false,  8,      true},
+                {"nonary",              AnyBaseConversion::nonary,              "012345678",                                                            false,  9,      false},
+                {"decimal",             AnyBaseConversion::decimal,             "0123456789",                                                           false,  10,     false},
+                {"undecimal",           AnyBaseConversion::undecimal,           "0123456789a",                                                          true,   11,     false},
+                {"duodecimal",          AnyBaseConversion::duodecimal,          "0123456789ab",                                                         true,   12,     false},
+                {"docenal",             AnyBaseConversion::docenal,             "0123456789ab",                                                         true,   12,     false},
+                {"tridecimal",          AnyBaseConversion::tridecimal,          "0123456789abc",                                                        true,   13,     false},
+                {"tetradecimal",        AnyBaseConversion::tetradecimal,        "0123456789abcd",                                                       true,   14,     false},
+                {"pentadecimal",        AnyBaseConversion::pentadecimal,        "0123456789abcde",                                                      true,   15,     false},
+                {"hexadecimal",         AnyBaseConversion::hexadecimal,         "0123456789abcdef",                                                     true,   16,     true},
+                {"vigesimal",           AnyBaseConversion::vigesimal,           "0123456789abcdefghjk",                                                 true,   20,     false},
+                {"tetravigesimal",      AnyBaseConversion::tetravigesimal,      "0123456789abcdefghjkmnpq",                                             true,   24,     false},
+                {"base32",              AnyBaseConversion::base32,              "abcdefghijklmnopqrstuvwxyz234567",                                     true,   32,     true},
+                {"base36",              AnyBaseConversion::base36,              "0123456789abcdefghijklmnopqrstuvwxyz",                                 true,   36,     false},
+                {"base58",              AnyBaseConversion::base58,              "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz",           false,  58,     false},
+                {"base64",              AnyBaseConversion::base64,              "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",     false,  64,     true}
+        }};
+
+        //The name under which base_information was first published, for code which iterates over it.
+        inline constexpr const std::array<BaseInformation, 22> &base_information_vector = base_information;
+
+        //Whether every entry of base_information is at the index of its Base, and its size and power-of-two flag match its digits.
+        constexpr bool is_base_information_consistent()
+        {
+                for (size_t i { 0 }; i < base_information.size(); i++)
+                {
+                        const BaseInformation &base_info = base_information[i];
+                        if (static_cast<size_t>(base_info.base) != i || base_info.size != base_info.digits.size() || base_info.is_power_of_two != ((base_info.size & (base_info.size - 1)) == 0))
+                                return false;
+                }
+                return true;
+        }
+        static_assert(is_base_information_consistent(), "base_information must be in the order of the Base enum");
+
+        //Builds the table from characters to digit values of a defined Base. Characters which are not digits map to 0xFF. Bases which allow uppercase also map their uppercase letters.
+        constexpr std::array<std::uint8_t, 256> build_defined_base_digit_values(Base base)
+        {
+                std::array<std::uint8_t, 256> digit_values {};
+                for (size_t i { 0 }; i < digit_values.size(); i++)
+                        digit_values[i] = 0xFF;
+                std::string_view digits = base_information[base].digits;
+                for (size_t value { 0 }; value < digits.size(); value++)
+                {
+                        unsigned char digit = static_cast<unsigned char>(digits[value]);
+                        digit_values[digit] = static_cast<std::uint8_t>(value);
+                        if (base_information[base].conversion_to_upper_case && digit >= 'a' && digit <= 'z')
+                                digit_values[digit - 'a' + 'A'] = static_cast<std::uint8_t>(value);
+                }
+                return digit_values;
+        }
+
+        //Builds the tables from characters to digit values of every defined Base.
+        constexpr std::array<std::array<std::uint8_t, 256>, 22> build_defined_base_digit_values()
+        {
+                std::array<std::array<std::uint8_t, 256>, 22> tables {};
+                for (size_t i { 0 }; i < tables.size(); i++)
+                        tables[i] = build_defined_base_digit_values(static_cast<Base>(i));
+                return tables;
+        }
+
+        //The tables from characters to digit values of the defined bases, indexed by their Base enum, built at compile time.
+        inline constexpr std::array<std::array<std::uint8_t, 256>, 22> defined_base_digit_values = build_defined_base_digit_values();
 
         //Given an AnyBaseConversion::Base input, returns the corresponding digits definition.
         std::string get_char_set_from_base(AnyBaseConversion::Base base)
         {
-                bool char_set_found {false};
-                std::vector<BaseInformation>::iterator it = base_information_vector.begin();
-                std::string char_set;
-                while (!char_set_found)
-                {
-                        BaseInformation current_base_info = *it;
-                        if (current_base_info.base == base)
-                        {
-                                char_set = current_base_info.digits;
-                                char_set_found = true;
-                        }
-                        it++;
-                }
-                return char_set;
+                return std::string(base_information[base].digits);
         }
 
         //Given an AnyBaseConversion::Base input, returns a bool  which indicates whether the base in question has an uppercase option (e.g. hexadecimal can use the digits "0123456789abcdef" or "0123456789ABCDEF".
-        bool does_base_allow_use_uppercase(AnyBaseConversion::Base base)
+        constexpr bool does_base_allow_use_uppercase(AnyBaseConversion::Base base)
         {
-                bool base_allows_uppercase = false;
-                bool base_information_found = false;
-                std::vector<BaseInformation>::iterator it = base_information_vector.begin();
-                while (!base_information_found)
-                {
-                        BaseInformation current_base_info = *it;
-                        if (current_base_info.base == base)
-                        {
-                                base_information_found = true;
-                                base_allows_uppercase = current_base_info.conversion_to_upper_case;
-                        }
-                        it++;
-                }
-                return base_allows_uppercase;
+                return base_information[base].conversion_to_upper_case;
         }
 
         //Utilities
 
-        //Reverses a wstring and returns the reversed wstring.
+        //Reverses a wstring and returns the reversed wstring. Deprecated.
+        [[deprecated("No longer used by AnyBaseConversion and will be removed in the next release. Use std::wstring(str.rbegin(), str.rend()) instead.")]]
         std::wstring reverse_wstring(std::wstring &str)
         {
                 std::wstring string_out {};
@@ -128,419 +170,2619 @@ namespace AnyBaseConversion
                         string_out += str[i-1];
                 }
                 return string_out;
+        }
+
+        //Whether every character of a string is ASCII.
+        template <typename CharT>
+        bool is_string_ascii(std::basic_string_view<CharT> s)
+        {
+                for (CharT c : s)
+                        if (static_cast<typename std::make_unsigned<CharT>::type>(c) >= 128)
+                                return false;
+                return true;
+        }
+
+        //Converts a UTF-8 string to a wstring. ASCII strings are widened byte by byte, so only strings with other characters are transcoded.
+        std::wstring convert_string_to_wstring(std::string_view s)
+        {
+                if (is_string_ascii(s))
+                        return std::wstring(s.begin(), s.end());
+                std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
+                return converter.from_bytes(s.data(), s.data() + s.size());
+        }
+
+        //Converts a wstring to a UTF-8 string. ASCII wstrings are narrowed character by character, so only wstrings with other characters are transcoded.
+        std::string convert_wstring_to_string(std::wstring_view s)
+        {
+                if (is_string_ascii(s))
+                {
+                        std::string narrow(s.size(), '\0');
+                        std::transform(s.begin(), s.end(), narrow.begin(), [](wchar_t c) { return static_cast<char>(c); });
+                        return narrow;
+                }
+                std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
+                return converter.to_bytes(s.data(), s.data() + s.size());
+        }
+
+        //Converts a UTF-32 string to a wstring. Where wchar_t is 16 bits wide, characters beyond U+FFFF become surrogate pairs.
+        std::wstring convert_u32string_to_wstring(std::u32string_view s)
+        {
+                std::wstring wide;
+                wide.reserve(s.size());
+                for (char32_t c : s)
+                {
+                        if (sizeof(wchar_t) < sizeof(char32_t) && c > 0xFFFF)
+                        {
+                                wide += static_cast<wchar_t>(0xD800 + ((c - 0x10000) >> 10));
+                                wide += static_cast<wchar_t>(0xDC00 + ((c - 0x10000) & 0x3FF));
+                        }
+                        else
+                                wide += static_cast<wchar_t>(c);
+                }
+                return wide;
+        }
+
+        //Convert a Base enum to its corresponding character set, as a wstring.
+        std::wstring convert_base_to_char_set(Base base)
+        {
+                std::string char_set = get_char_set_from_base(base);
+                return convert_string_to_wstring(char_set);
+        }
+
+        //Counts the number of times a character appears in a wstring. Deprecated.
+        [[deprecated("No longer used by AnyBaseConversion and will be removed in the next release. Use std::count(str.begin(), str.end(), character) instead.")]]
+        size_t count_instances_of_wchar_t_in_wstring(wchar_t character, std::wstring &str)
+        {
+                size_t num { 0 };
+                for (wchar_t c : str)
+                        if (c == character)
+                                num++;
+                return num;
+        }
+
+#ifdef __SIZEOF_INT128__
+        __extension__ typedef unsigned __int128 NativeInteger; //The widest native unsigned integer. Integers which fit in it are converted with native arithmetic rather than with big integers.
+#else
+        typedef std::uint64_t NativeInteger;
+#endif
+
+        //The values of the digits of a number are held in the narrowest type which fits every digit of its alphabet: one byte for alphabets of at most 256 digits, which all the defined bases are, and four bytes otherwise.
+        typedef std::uint8_t NarrowDigitValue;
+        typedef std::uint32_t WideDigitValue;
+
+        //Returns the largest number of digits in a given base whose values always fit in a Word, counted as the largest k for which base^k itself fits, so that base^k can be used as a divisor. By default the Word is 64 bits.
+        template <typename Word = std::uint64_t>
+        constexpr size_t get_digits_per_word(size_t base)
+        {
+                if (base < 2)
+                        return 1;
+                size_t digits_per_word { 0 };
+                Word word_power { 1 };
+                while (word_power <= static_cast<Word>(~static_cast<Word>(0)) / base)
+                {
+                        word_power *= base;
+                        digits_per_word++;
+                }
+                return digits_per_word;
+        }
+
+        //Divides 64-bit words by a divisor from 2 to 2^63 fixed at run time. The quotient is found by multiplying by a precomputed reciprocal and shifting, rather than by a hardware division (Granlund and Montgomery, "Division by Invariant Integers using Multiplication", figure 4.1).
+        class WordDivisor
+        {
+        public:
+                WordDivisor()
+                {
+                        //No action.
+                }
+
+                explicit WordDivisor(std::uint64_t divisor) : divisor(divisor)
+                {
+#ifdef __SIZEOF_INT128__
+                        if (divisor < 2)
+                                return;
+                        while ((static_cast<std::uint64_t>(1) << shift) < divisor)
+                                shift++;
+                        //multiplier = floor(2^64 * (2^shift - divisor) / divisor) + 1, which is below 2^64.
+                        multiplier = static_cast<std::uint64_t>((static_cast<NativeInteger>((static_cast<std::uint64_t>(1) << shift) - divisor) << 64) / divisor) + 1;
+#endif
+                }
+
+                //Returns n / divisor.
+                std::uint64_t divide(std::uint64_t n) const
+                {
+#ifdef __SIZEOF_INT128__
+                        std::uint64_t high = static_cast<std::uint64_t>((static_cast<NativeInteger>(multiplier) * n) >> 64);
+                        return (high + ((n - high) >> 1)) >> (shift - 1);
+#else
+                        return n / divisor;
+#endif
+                }
+
+                std::uint64_t get_divisor() const
+                {
+                        return divisor;
+                }
+
+        private:
+                std::uint64_t           divisor {1};
+                std::uint64_t           multiplier {0};
+                unsigned int            shift {0};
+        };
+
+        //Validation return carries information about whether a character set has been validated, and any errors which were encountered.
+        struct ValidationReturn
+        {
+                bool valid; //Whether the inputted item has been validated.
+                std::vector<std::string> error_messages; //Any error messages created during the validation.
+        };
+
+        //Alphabet is a set of digits which has been validated once, with a reverse lookup table from characters to digit values. It can be built once and reused for any number of conversions.
+        //Characters below 256 are looked up directly in an array; wider characters are found by binary search in a sorted table. Alphabets of defined bases which allow uppercase also map the uppercase form of each letter digit to its value.
+        class Alphabet
+        {
+        public:
+                //Construct an empty alphabet.
+                Alphabet()
+                {
+                        build_tables();
+                }
+
+                //Construct an empty alphabet whose digits and tables are allocated from a memory resource. Alphabets assigned to it later are copied into that resource.
+                explicit Alphabet(std::pmr::memory_resource *resource) : digits(resource), wide_table(resource)
+                {
+                        build_tables();
+                }
+
+                //Construct the alphabet of an AnyBaseConversion defined Base, with its digits and tables allocated from a memory resource.
+                explicit Alphabet(Base base, std::pmr::memory_resource *resource = std::pmr::get_default_resource()) : digits(resource), wide_table(resource)
+                {
+                        digits = convert_base_to_char_set(base);
+                        uppercase_allowed = does_base_allow_use_uppercase(base);
+                        build_tables();
+                }
+
+                //Construct an alphabet from a user-defined std::wstring definition of the numbering.
+                Alphabet(std::wstring_view digits_w) : digits(digits_w)
+                {
+                        build_tables();
+                }
+
+                //Construct an alphabet from a user-defined UTF-8 std::string definition of the numbering.
+                Alphabet(std::string_view digits_s) : digits(convert_string_to_wstring(digits_s))
+                {
+                        build_tables();
+                }
+
+                //Construct an alphabet from a user-defined UTF-32 std::u32string definition of the numbering.
+                Alphabet(std::u32string_view digits_u32) : digits(convert_u32string_to_wstring(digits_u32))
+                {
+                        build_tables();
+                }
+
+                //Whether every digit is unique, so that the alphabet can be used for base conversion.
+                bool is_valid() const
+                {
+                        return validation_return.valid;
+                }
+
+                //The result of validating the digits, including any error messages.
+                const ValidationReturn &get_validation_return() const
+                {
+                        return validation_return;
+                }
+
+                //The number of digits, i.e. the base.
+                size_t get_base() const
+                {
+                        return digits.length();
+                }
+
+                //The digits, in order.
+                const std::pmr::wstring &get_digits() const
+                {
+                        return digits;
+                }
+
+                //The character of the digit with a given value.
+                wchar_t get_digit(size_t value) const
+                {
+                        return digits[value];
+                }
+
+                //The value of a digit character, or std::wstring::npos if the character is not a digit.
+                size_t get_digit_value(wchar_t character) const
+                {
+                        if (static_cast<std::make_unsigned<wchar_t>::type>(character) < direct_table.size())
+                                return direct_table[static_cast<std::make_unsigned<wchar_t>::type>(character)];
+                        auto it = std::lower_bound(wide_table.begin(), wide_table.end(), std::make_pair(character, static_cast<size_t>(0)));
+                        if (it != wide_table.end() && it->first == character)
+                                return it->second;
+                        return std::wstring::npos;
+                }
+
+                //Whether the letter digits may also be written in uppercase.
+                bool does_allow_uppercase() const
+                {
+                        return uppercase_allowed;
+                }
+
+                //Whether every digit is an ASCII character, so numbers in this alphabet can be read and written as bytes.
+                bool is_ascii() const
+                {
+                        return ascii;
+                }
+
+                //The number of digits which always fit in a 64-bit word, and base to that power.
+                size_t get_word_digits() const
+                {
+                        return word_digits;
+                }
+
+                std::uint64_t get_word_power() const
+                {
+                        return word_power;
+                }
+
+                //The number of digits which always fit in a NativeInteger.
+                size_t get_native_digits() const
+                {
+                        return native_digits;
+                }
+
+                //Divides words by the base without a hardware division.
+                const WordDivisor &get_divisor() const
+                {
+                        return divisor;
+                }
+
+        private:
+                std::pmr::wstring                               digits;
+                bool                                            uppercase_allowed {false};
+                bool                                            ascii {true};
+                size_t                                          word_digits {1};
+                std::uint64_t                                   word_power {1};
+                size_t                                          native_digits {1};
+                WordDivisor                                     divisor;
+                ValidationReturn                                validation_return;
+                std::array<size_t, 256>                         direct_table;
+                std::pmr::vector<std::pair<wchar_t, size_t>>    wide_table; //Sorted by character.
+
+                //Adds a character to the lookup tables, unless it is already there. Returns whether it was added. The wide table must be sorted again before use.
+                bool add_to_tables(wchar_t character, size_t value)
+                {
+                        if (static_cast<std::make_unsigned<wchar_t>::type>(character) >= direct_table.size())
+                        {
+                                wide_table.push_back(std::make_pair(character, value));
+                                return true;
+                        }
+                        size_t &entry = direct_table[static_cast<std::make_unsigned<wchar_t>::type>(character)];
+                        if (entry != std::wstring::npos)
+                                return false;
+                        entry = value;
+                        return true;
+                }
+
+                //Sorts the wide table and removes repeated characters, keeping the lowest value of each. Returns whether any were removed.
+                bool sort_wide_table()
+                {
+                        std::sort(wide_table.begin(), wide_table.end());
+                        size_t size_before = wide_table.size();
+                        wide_table.erase(std::unique(wide_table.begin(), wide_table.end(), [](const std::pair<wchar_t, size_t> &a, const std::pair<wchar_t, size_t> &b) { return a.first == b.first; }), wide_table.end());
+                        return wide_table.size() != size_before;
+                }
+
+                //Fills the lookup tables and validates the digits in the same pass. A repeated character keeps the value of its first instance.
+                void build_tables()
+                {
+                        direct_table.fill(std::wstring::npos);
+                        ascii = is_string_ascii(std::wstring_view(digits));
+                        word_digits = get_digits_per_word(digits.length());
+                        word_power = 1;
+                        if (digits.length() >= 2)
+                        {
+                                for (size_t i {0}; i < word_digits; i++)
+                                        word_power *= digits.length();
+                        }
+                        native_digits = get_digits_per_word<NativeInteger>(digits.length());
+                        divisor = WordDivisor(digits.length());
+                        bool repeat_digit_found {false};
+                        for (size_t value {0}; value < digits.length(); value++)
+                        {
+                                if (!add_to_tables(digits[value], value))
+                                        repeat_digit_found = true;
+                        }
+                        if (sort_wide_table())
+                                repeat_digit_found = true;
+                        if (uppercase_allowed)
+                        {
+                                for (size_t value {0}; value < digits.length(); value++)
+                                {
+                                        wchar_t uppercase_digit = static_cast<wchar_t>(std::towupper(digits[value]));
+                                        if (uppercase_digit != digits[value] && get_digit_value(uppercase_digit) == std::wstring::npos)
+                                                add_to_tables(uppercase_digit, value);
+                                }
+                                sort_wide_table();
+                        }
+                        if (repeat_digit_found)
+                        {
+                                validation_return.valid = false;
+                                validation_return.error_messages.push_back("The inputted set of digits contains repeat characters. To be used for base conversion, every character must be unique.");
+                        }
+                        else
+                                validation_return.valid = true;
+                }
+        };
+
+        //Given an AnyBaseConversion::Base input, returns its Alphabet. The Alphabet of each defined base is only built once.
+        //They last for the life of the process, so they are allocated with new and delete rather than from the default memory resource, which may be a short-lived one when they are first asked for.
+        const Alphabet &get_alphabet_from_base(AnyBaseConversion::Base base)
+        {
+                static const std::vector<Alphabet> alphabets = []()
+                {
+                        std::vector<Alphabet> defined_alphabets;
+                        defined_alphabets.reserve(base_information.size());
+                        for (const BaseInformation &base_info : base_information) //In the order of the Base enum.
+                                defined_alphabets.emplace_back(base_info.base, std::pmr::new_delete_resource());
+                        return defined_alphabets;
+                }();
+                return alphabets[base];
         }
 
-        //Calculates base to the power of exp.
-        boost::multiprecision::cpp_int exponent(size_t base, size_t exp)
+        //The memory resource which the allocations of conversions on this thread draw from, while a MemoryResourceScope is active. Null otherwise.
+        inline thread_local std::pmr::memory_resource *thread_memory_resource {nullptr};
+
+        //Returns the memory resource which the allocations of conversions on this thread draw from: that of the innermost MemoryResourceScope, or std::pmr::get_default_resource().
+        std::pmr::memory_resource *get_thread_memory_resource()
+        {
+                return thread_memory_resource != nullptr ? thread_memory_resource : std::pmr::get_default_resource();
+        }
+
+        //MemoryResourceScope makes the allocations of conversions on this thread draw from a memory resource until it is destroyed, when the previous resource is restored. Scopes nest.
+        class MemoryResourceScope
+        {
+        public:
+                explicit MemoryResourceScope(std::pmr::memory_resource *resource) : previous_resource(thread_memory_resource)
+                {
+                        thread_memory_resource = resource;
+                }
+
+                ~MemoryResourceScope()
+                {
+                        thread_memory_resource = previous_resource;
+                }
+
+                MemoryResourceScope(const MemoryResourceScope &) = delete;
+                MemoryResourceScope &operator=(const MemoryResourceScope &) = delete;
+
+        private:
+                std::pmr::memory_resource       *previous_resource;
+        };
+
+        //ResourceAllocator allocates from the memory resource which was current on the thread when it was constructed. Big integers which use it for their limbs take their memory from the conversion that built them, and keep that resource when they are copied or moved.
+        template <typename T>
+        class ResourceAllocator
+        {
+        public:
+                typedef T value_type;
+
+                ResourceAllocator() noexcept : resource(get_thread_memory_resource())
+                {
+                        //No action.
+                }
+
+                template <typename U>
+                ResourceAllocator(const ResourceAllocator<U> &other) noexcept : resource(other.get_resource())
+                {
+                        //No action.
+                }
+
+                T *allocate(size_t n)
+                {
+                        return static_cast<T *>(resource->allocate(n * sizeof(T), alignof(T)));
+                }
+
+                void deallocate(T *p, size_t n)
+                {
+                        resource->deallocate(p, n * sizeof(T), alignof(T));
+                }
+
+                std::pmr::memory_resource *get_resource() const noexcept
+                {
+                        return resource;
+                }
+
+        private:
+                std::pmr::memory_resource       *resource;
+        };
+
+        template <typename T, typename U>
+        bool operator==(const ResourceAllocator<T> &a, const ResourceAllocator<U> &b) noexcept
+        {
+                return a.get_resource() == b.get_resource() || a.get_resource()->is_equal(*b.get_resource());
+        }
+
+        template <typename T, typename U>
+        bool operator!=(const ResourceAllocator<T> &a, const ResourceAllocator<U> &b) noexcept
+        {
+                return !(a == b);
+        }
+
+        //The cpp_int whose limbs are allocated from the thread's memory resource, for use with BasicBaseConversion and a std::pmr::memory_resource.
+        typedef boost::multiprecision::number<boost::multiprecision::cpp_int_backend<0, 0, boost::multiprecision::signed_magnitude, boost::multiprecision::unchecked, ResourceAllocator<boost::multiprecision::limb_type>>> pmr_cpp_int;
+
+        //BasicOutputBuffer holds the characters of one output in a single preallocated string. The part before the point is written from the back, the point and the part after it are appended, and dropping characters from either end only moves an index,
+        //so the characters are copied once more only when the finished string is taken. The digit values and integer bits which the writers read are not part of it: the conversion holds them in vectors of their own.
+        //It can instead work in storage owned by the caller, which is never grown: characters that do not fit are dropped and overflowed() becomes true.
+        template <typename CharT>
+        class BasicOutputBuffer
+        {
+        public:
+                //Construct an empty buffer.
+                BasicOutputBuffer()
+                {
+                        //No action.
+                }
+
+                //Construct an empty buffer whose storage is allocated from a memory resource.
+                explicit BasicOutputBuffer(std::pmr::memory_resource *resource) : storage(resource)
+                {
+                        //No action.
+                }
+
+                //Construct with room for front_capacity characters written from the back and back_capacity characters appended after them.
+                BasicOutputBuffer(size_t front_capacity, size_t back_capacity)
+                {
+                        reset(front_capacity, back_capacity);
+                }
+
+                //Construct over external_capacity characters of caller-owned storage, the first front_capacity of which are for characters written from the back. That split is kept when the buffer is reset.
+                BasicOutputBuffer(CharT *external_data, size_t external_capacity, size_t front_capacity) : external_data(external_data), external_capacity(external_capacity), external_front_capacity(std::min(front_capacity, external_capacity))
+                {
+                        reset(front_capacity, 0);
+                }
+
+                //Empties the buffer, with room for front_capacity characters written from the back and back_capacity characters appended after them. An owned buffer grows if either is exceeded.
+                void reset(size_t front_capacity, size_t back_capacity)
+                {
+                        if (external_data != nullptr)
+                                front_capacity = external_front_capacity;
+                        else
+                                storage.assign(front_capacity + back_capacity, CharT {});
+                        first = front_capacity;
+                        last = front_capacity;
+                        point = npos;
+                        overflow = false;
+                }
+
+                void push_front(CharT character)
+                {
+                        if (first == 0 && !grow_front())
+                                return;
+                        data()[--first] = character;
+                }
+
+                void push_back(CharT character)
+                {
+                        if (last == capacity())
+                        {
+                                if (external_data != nullptr)
+                                {
+                                        overflow = true;
+                                        return;
+                                }
+                                storage.push_back(character);
+                        }
+                        else
+                                data()[last] = character;
+                        last++;
+                }
+
+                void pop_front()
+                {
+                        first++;
+                }
+
+                void pop_back()
+                {
+                        last--;
+                }
+
+                CharT &front()
+                {
+                        return data()[first];
+                }
+
+                CharT &back()
+                {
+                        return data()[last - 1];
+                }
+
+                //The character at a position counted from the front.
+                CharT &operator[](size_t position)
+                {
+                        return data()[first + position];
+                }
+
+                size_t size() const
+                {
+                        return last - first;
+                }
+
+                bool empty() const
+                {
+                        return first == last;
+                }
+
+                CharT *begin()
+                {
+                        return data() + first;
+                }
+
+                CharT *end()
+                {
+                        return data() + last;
+                }
+
+                //Whether characters were dropped because caller-owned storage was full.
+                bool overflowed() const
+                {
+                        return overflow;
+                }
+
+                //Appends the point, after which the characters belong to the part after the point.
+                void push_point(CharT point_character)
+                {
+                        point = last;
+                        push_back(point_character);
+                }
+
+                bool has_point() const
+                {
+                        return point != npos;
+                }
+
+                //The position of the first character after the point, counted from the front, or size() if there is no point.
+                size_t get_after_point_position() const
+                {
+                        return has_point() ? point + 1 - first : size();
+                }
+
+                //The whole output.
+                std::basic_string<CharT> str() const
+                {
+                        return std::basic_string<CharT>(data() + first, data() + last);
+                }
+
+                //The whole output, valid until the buffer is next changed.
+                std::basic_string_view<CharT> view() const
+                {
+                        return std::basic_string_view<CharT>(data() + first, last - first);
+                }
+
+                //The part of the output before the point, valid until the buffer is next changed.
+                std::basic_string_view<CharT> get_before_point() const
+                {
+                        return std::basic_string_view<CharT>(data() + first, (has_point() ? point : last) - first);
+                }
+
+                //The part of the output after the point, valid until the buffer is next changed.
+                std::basic_string_view<CharT> get_after_point() const
+                {
+                        return has_point() ? std::basic_string_view<CharT>(data() + point + 1, last - point - 1) : std::basic_string_view<CharT> {};
+                }
+
+                //Moves the output to the start of the storage and returns its length. Used to hand caller-owned storage back with the output at its start.
+                size_t move_to_start()
+                {
+                        std::copy(data() + first, data() + last, data());
+                        if (has_point())
+                                point -= first;
+                        last -= first;
+                        first = 0;
+                        return last;
+                }
+
+        private:
+                static constexpr size_t         npos {static_cast<size_t>(-1)};
+                std::pmr::basic_string<CharT>   storage;
+                CharT                           *external_data {nullptr}; //Caller-owned storage, if used instead of storage.
+                size_t                          external_capacity {0};
+                size_t                          external_front_capacity {0};
+                size_t                          first {0}; //Index of the first character.
+                size_t                          last {0}; //Index one past the last character.
+                size_t                          point {npos}; //Index of the point, if one has been appended.
+                bool                            overflow {false};
+
+                CharT *data()
+                {
+                        return external_data != nullptr ? external_data : &storage[0];
+                }
+
+                const CharT *data() const
+                {
+                        return external_data != nullptr ? external_data : storage.data();
+                }
+
+                size_t capacity() const
+                {
+                        return external_data != nullptr ? external_capacity : storage.size();
+                }
+
+                //Makes room in front of the first character. Returns false, and records the overflow, if the storage is caller-owned.
+                bool grow_front()
+                {
+                        if (external_data != nullptr)
+                        {
+                                overflow = true;
+                                return false;
+                        }
+                        size_t extra_capacity = std::max(static_cast<size_t>(16), storage.size());
+                        storage.insert(0, extra_capacity, CharT {});
+                        first += extra_capacity;
+                        last += extra_capacity;
+                        if (has_point())
+                                point += extra_capacity;
+                        return true;
+                }
+        };
+
+        //The OutputBuffer used for wstring outputs.
+        typedef BasicOutputBuffer<wchar_t> OutputBuffer;
+
+        //PowerCache is the process-wide store of powers of bases used by every conversion. For each base it keeps the table of repeated squares base^(2^k), which the divide-and-conquer parser and formatter split on, and memoized exact powers base^exp.
+        //Any number of threads may read it at once. Powers are handed out as shared pointers, so clearing the cache never invalidates a power in use. Once the memory limit is reached, new powers are still calculated and returned, but are no longer stored.
+        //The cache is kept per integer type, so that each BasicBaseConversion<Integer> multiplies powers of its own type; PowerCache is the one for cpp_int. Stored powers outlive any one conversion, so they are always allocated from new and delete, never from a conversion's memory resource.
+        template <typename Integer>
+        class BasicPowerCache
+        {
+        public:
+                //Returns the process-wide cache for this integer type.
+                static BasicPowerCache &instance()
+                {
+                        static BasicPowerCache power_cache {};
+                        return power_cache;
+                }
+
+                //Returns base^(2^k).
+                std::shared_ptr<const Integer> get_squared_power(size_t base, size_t k)
+                {
+                        MemoryResourceScope memory_resource_scope(std::pmr::new_delete_resource());
+                        std::shared_ptr<const Integer> power;
+                        size_t first_missing_k { 0 };
+                        {
+                                std::shared_lock<std::shared_mutex> lock(mutex);
+                                auto it = powers_by_base.find(base);
+                                if (it != powers_by_base.end() && !it->second.squared_powers.empty())
+                                {
+                                        std::vector<std::shared_ptr<const Integer>> &squared_powers = it->second.squared_powers;
+                                        if (k < squared_powers.size())
+                                                return squared_powers[k];
+                                        power = squared_powers.back();
+                                        first_missing_k = squared_powers.size();
+                                }
+                        }
+                        if (!power)
+                        {
+                                power = std::make_shared<const Integer>(base);
+                                store_squared_power(base, 0, power);
+                                first_missing_k = 1;
+                        }
+                        for (size_t j { first_missing_k }; j <= k; j++)
+                        {
+                                power = std::make_shared<const Integer>(*power * *power);
+                                store_squared_power(base, j, power);
+                        }
+                        return power;
+                }
+
+                //Returns base^exp.
+                std::shared_ptr<const Integer> get_power(size_t base, size_t exp)
+                {
+                        MemoryResourceScope memory_resource_scope(std::pmr::new_delete_resource());
+                        {
+                                std::shared_lock<std::shared_mutex> lock(mutex);
+                                auto it = powers_by_base.find(base);
+                                if (it != powers_by_base.end())
+                                {
+                                        auto power_it = it->second.exact_powers.find(exp);
+                                        if (power_it != it->second.exact_powers.end())
+                                                return power_it->second;
+                                }
+                        }
+                        Integer result { 1 };
+                        for (size_t k { 0 }; (exp >> k) != 0; k++)
+                        {
+                                if ((exp >> k) & 1)
+                                        result *= *get_squared_power(base, k);
+                        }
+                        std::shared_ptr<const Integer> power = std::make_shared<const Integer>(std::move(result));
+                        std::unique_lock<std::shared_mutex> lock(mutex);
+                        if (has_room_for(*power))
+                        {
+                                auto inserted = powers_by_base[base].exact_powers.emplace(exp, power);
+                                if (inserted.second)
+                                        memory_used += get_memory_size(*power);
+                                else
+                                        power = inserted.first->second;
+                        }
+                        return power;
+                }
+
+                //Removes every stored power.
+                void clear()
+                {
+                        std::unique_lock<std::shared_mutex> lock(mutex);
+                        powers_by_base.clear();
+                        memory_used = 0;
+                }
+
+                //Sets the memory budget in bytes. If more than this is already stored, the cache is cleared.
+                void set_memory_limit(size_t bytes)
+                {
+                        std::unique_lock<std::shared_mutex> lock(mutex);
+                        memory_limit = bytes;
+                        if (memory_used > memory_limit)
+                        {
+                                powers_by_base.clear();
+                                memory_used = 0;
+                        }
+                }
+
+                //Returns the memory budget in bytes.
+                size_t get_memory_limit()
+                {
+                        std::shared_lock<std::shared_mutex> lock(mutex);
+                        return memory_limit;
+                }
+
+                //Returns the approximate number of bytes used by the stored powers.
+                size_t get_memory_used()
+                {
+                        std::shared_lock<std::shared_mutex> lock(mutex);
+                        return memory_used;
+                }
+
+        private:
+                struct PowersOfBase
+                {
+                        std::vector<std::shared_ptr<const Integer>>                        squared_powers; //base^(2^k) at index k.
+                        boost::container::flat_map<size_t, std::shared_ptr<const Integer>> exact_powers; //base^exp, keyed by exp.
+                };
+
+                std::shared_mutex                                       mutex;
+                boost::container::flat_map<size_t, PowersOfBase>        powers_by_base;
+                size_t                                                  memory_limit {power_cache_memory_limit_default};
+                size_t                                                  memory_used {0};
+
+                static size_t get_memory_size(const Integer &power)
+                {
+                        return sizeof(Integer) + boost::multiprecision::msb(power) / 8 + 1;
+                }
+
+                bool has_room_for(const Integer &power)
+                {
+                        return memory_used + get_memory_size(power) <= memory_limit;
+                }
+
+                //Stores base^(2^k), if the squares below it are stored and there is room.
+                void store_squared_power(size_t base, size_t k, std::shared_ptr<const Integer> &power)
+                {
+                        std::unique_lock<std::shared_mutex> lock(mutex);
+                        if (!has_room_for(*power))
+                                return;
+                        std::vector<std::shared_ptr<const Integer>> &squared_powers = powers_by_base[base].squared_powers;
+                        if (squared_powers.size() == k)
+                        {
+                                squared_powers.push_back(power);
+                                memory_used += get_memory_size(*power);
+                        }
+                }
+        };
+
+        //The PowerCache used for cpp_int.
+        typedef BasicPowerCache<boost::multiprecision::cpp_int> PowerCache;
+
+        //Calculates base to the power of exp. Deprecated.
+        template <typename Integer = boost::multiprecision::cpp_int>
+        [[deprecated("No longer used by AnyBaseConversion and will be removed in the next release. Use *BasicPowerCache<Integer>::instance().get_power(base, exp) instead.")]]
+        Integer exponent(size_t base, size_t exp)
         {
-                        boost::multiprecision::cpp_int result { 1 };
-                        boost::multiprecision::cpp_int basecu { base };
-                        for (size_t i = 1; i <= exp; ++i)
-                        {
-                                result = result * basecu;
-                        }
-
-                        return result;
-        }
-
+                        return *BasicPowerCache<Integer>::instance().get_power(base, exp);
+        }
+
+        //Calculates base to the power of exp in a bounded type which the result is known to fit in. Takes a few multiplications, so it is not cached.
+        template <typename Integer>
+        Integer calculate_power(size_t base, size_t exp)
+        {
+                Integer result { 1 };
+                Integer square { base };
+                while (exp != 0)
+                {
+                        if (exp & 1)
+                                result *= square;
+                        exp >>= 1;
+                        if (exp != 0)
+                                square *= square;
+                }
+                return result;
+        }
+
+        //Converts the digit values in [first, last), most significant first, to an integer in a given base. Every digit value must be less than base, as the values decoded through an Alphabet always are.
+        //Digits are gathered into chunks of get_digits_per_word(base) digits using native arithmetic, and each chunk costs a single multiply-by-word and add on the big integer.
+        template <typename Integer = boost::multiprecision::cpp_int, typename DigitValue>
+        Integer convert_digit_values_to_integer_directly(const std::pmr::vector<DigitValue> &digit_values, size_t first, size_t last, size_t base)
+        {
+                size_t digits_per_word = get_digits_per_word(base);
+                Integer num { 0 };
+                size_t i { first };
+                while (i < last)
+                {
+                        size_t chunk_end = std::min(last, i + digits_per_word);
+                        std::uint64_t chunk { 0 };
+                        std::uint64_t chunk_power { 1 };
+                        for (size_t j { i }; j < chunk_end; j++)
+                        {
+                                chunk = chunk * base + digit_values[j];
+                                chunk_power *= base;
+                        }
+                        num *= chunk_power;
+                        num += chunk;
+                        i = chunk_end;
+                }
+                return num;
+        }
+
+        //Converts the digit values in [first, last), most significant first, to an integer in a given base.
+        //Above divide_and_conquer_parse_threshold the digits are split so that the lower part has a length of 2^k, both parts are converted recursively, and the upper part is shifted up with a single multiplication by base^(2^k) from the PowerCache.
+        template <typename Integer = boost::multiprecision::cpp_int, typename DigitValue>
+        Integer convert_digit_values_to_integer(const std::pmr::vector<DigitValue> &digit_values, size_t first, size_t last, size_t base)
+        {
+                size_t length = last - first;
+                if (length <= divide_and_conquer_parse_threshold)
+                        return convert_digit_values_to_integer_directly<Integer>(digit_values, first, last, base);
+                size_t k { 0 };
+                while ((static_cast<size_t>(2) << k) < length)
+                        k++;
+                size_t split = last - (static_cast<size_t>(1) << k);
+                Integer num = convert_digit_values_to_integer<Integer>(digit_values, first, split, base);
+                num *= *BasicPowerCache<Integer>::instance().get_squared_power(base, k);
+                num += convert_digit_values_to_integer<Integer>(digit_values, split, last, base);
+                return num;
+        }
+
+        //Converts a wstring to the values of its digits in a given base, most significant first, held as DigitValue: NarrowDigitValue if the alphabet has at most 256 digits, otherwise WideDigitValue.
+        template <typename DigitValue>
+        std::pmr::vector<DigitValue> convert_wstring_to_digit_values(std::wstring &num_string, const Alphabet &alphabet)
+        {
+                std::pmr::vector<DigitValue> digit_values(num_string.length(), get_thread_memory_resource());
+                for (size_t i { 0 }; i < num_string.length(); i++)
+                        digit_values[i] = static_cast<DigitValue>(alphabet.get_digit_value(num_string[i]));
+                return digit_values;
+        }
+
+        //Converts a wstring to an integer using a given base. Every character must be a digit of the alphabet, as it is not checked here.
+        boost::multiprecision::cpp_int convert_number_wstring_to_integer(std::wstring &num_string, const Alphabet &alphabet)
+        {
+                size_t base = alphabet.get_base();
+                if (base <= 256)
+                {
+                        std::pmr::vector<NarrowDigitValue> digit_values = convert_wstring_to_digit_values<NarrowDigitValue>(num_string, alphabet);
+                        return convert_digit_values_to_integer(digit_values, 0, digit_values.size(), base);
+                }
+                std::pmr::vector<WideDigitValue> digit_values = convert_wstring_to_digit_values<WideDigitValue>(num_string, alphabet);
+                return convert_digit_values_to_integer(digit_values, 0, digit_values.size(), base);
+        }
+
         //Converts a wstring to an integer using a given base.
         boost::multiprecision::cpp_int convert_number_wstring_to_integer(std::wstring &num_string, std::wstring &char_set)
         {
-                size_t base = char_set.length();
-                boost::multiprecision::cpp_int num { 0 };
-                std::wstring use_string = reverse_wstring(num_string);
-                size_t value { 0 };
-                for (size_t i { 0 }; i < use_string.length(); i++)
-                {
-                        value = char_set.find_first_of(use_string[i]);
-                        num += (value * exponent(base, i));
-                }
-                return num;
+                return convert_number_wstring_to_integer(num_string, Alphabet(char_set));
         }
 
-        //Converts an integer to a wstring in a given base.
-        std::wstring convert_integer_to_wstring(boost::multiprecision::cpp_int num, std::wstring &char_set)
+        //Returns an upper bound on the number of digits of an integer in a given base, from its length in bits and the ratio of the logarithms of 2 and the base.
+        template <typename Integer>
+        size_t estimate_number_of_digits(const Integer &num, size_t base)
+        {
+                if (num == 0 || base < 2)
+                        return 1;
+                size_t bits = boost::multiprecision::msb(num) + 1;
+                return static_cast<size_t>(static_cast<double>(bits) * std::log(2.0) / std::log(static_cast<double>(base))) + 2;
+        }
+
+        //Writes an integer in a given base to the front of an OutputBuffer, padding it on the left with the zero digit up to minimum_length.
+        //Each pass divides the big integer once by base^k, where k = get_digits_per_word(base), and the k digits of the word-sized remainder are then written with native arithmetic.
+        template <typename Integer, typename CharT>
+        void write_integer_directly(Integer num, const Alphabet &alphabet, size_t minimum_length, BasicOutputBuffer<CharT> &output_buffer)
         {
-                size_t base = char_set.length();
-                std::wstring output_string {};
-                boost::multiprecision::cpp_int remainder;
-                size_t remainder_st {};
+                size_t base = alphabet.get_base();
+                size_t digits_written { 0 };
+                size_t digits_per_word = get_digits_per_word(base);
+                std::uint64_t word_power { 1 };
+                for (size_t i { 0 }; i < digits_per_word; i++)
+                        word_power *= base;
+                Integer divisor { word_power };
+                Integer quotient;
+                Integer remainder;
                 while (num != 0)
                 {
-                        remainder = num % base;
-                        remainder_st = static_cast<size_t>(boost::multiprecision::number(remainder));
-                        num = num / base;
-                        output_string = char_set[remainder_st] + output_string;
+                        boost::multiprecision::divide_qr(num, divisor, quotient, remainder);
+                        num.swap(quotient);
+                        std::uint64_t chunk = static_cast<std::uint64_t>(remainder);
+                        if (num != 0) //Not the most significant chunk, so all of its digits are written, including zeroes.
+                        {
+                                for (size_t i { 0 }; i < digits_per_word; i++)
+                                {
+                                        output_buffer.push_front(alphabet.get_digit(static_cast<size_t>(chunk % base)));
+                                        chunk /= base;
+                                }
+                                digits_written += digits_per_word;
+                        }
+                        else
+                        {
+                                while (chunk != 0)
+                                {
+                                        output_buffer.push_front(alphabet.get_digit(static_cast<size_t>(chunk % base)));
+                                        chunk /= base;
+                                        digits_written++;
+                                }
+                        }
                 }
-                return output_string;
-        }
-
-        //Converts a string to a wstring.
-        std::wstring convert_string_to_wstring(std::string &s)
-        {
-                std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
-                return converter.from_bytes(s);
-        }
-
-        //Converts a wstring to a string.
-        std::string convert_wstring_to_string(std::wstring &s)
-        {
-                std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converter;
-                return converter.to_bytes(s);
-        }
-
-        //Convert a Base enum to its corresponding character set, as a wstring.
-        std::wstring convert_base_to_char_set(Base base)
-        {
-                std::string char_set = get_char_set_from_base(base);
-                return convert_string_to_wstring(char_set);
-        }
-
-        //Counts the number of times a character appears in a wstring.
-        size_t count_instances_of_wchar_t_in_wstring(wchar_t character, std::wstring &str)
-        {
-                size_t num { 0 };
-                for (wchar_t c : str)
-                        if (c == character)
-                                num++;
-                return num;
+                for (; digits_written < minimum_length; digits_written++)
+                        output_buffer.push_front(alphabet.get_digit(0));
+        }
+
+        //Writes an integer below base^(2^k) to the front of an OutputBuffer as exactly 2^k digits, including any leading zeroes.
+        //Long integers are split by base^(2^(k-1)) and each half is written recursively, lower half first, so the zero padding inside the lower half is kept.
+        template <typename Integer, typename CharT>
+        void write_integer_padded(const Integer &num, const Alphabet &alphabet, size_t k, BasicOutputBuffer<CharT> &output_buffer)
+        {
+                size_t length = static_cast<size_t>(1) << k;
+                if (length <= divide_and_conquer_format_threshold)
+                        write_integer_directly(num, alphabet, length, output_buffer);
+                else
+                {
+                        Integer quotient;
+                        Integer remainder;
+                        boost::multiprecision::divide_qr(num, *BasicPowerCache<Integer>::instance().get_squared_power(alphabet.get_base(), k - 1), quotient, remainder);
+                        write_integer_padded(remainder, alphabet, k - 1, output_buffer);
+                        write_integer_padded(quotient, alphabet, k - 1, output_buffer);
+                }
+        }
+
+        //Writes an integer in a given base to the front of an OutputBuffer, without leading zeroes. Zero writes nothing.
+        //Above divide_and_conquer_format_threshold digits, the integer is split by the largest base^(2^k) from the PowerCache not above it: the remainder is written as exactly 2^k digits and the quotient is written recursively in front of it.
+        //For a bounded Integer the search stops before a square which would not fit in the type, as that square is known to be above num.
+        template <typename Integer, typename CharT>
+        void write_integer(const Integer &num, const Alphabet &alphabet, BasicOutputBuffer<CharT> &output_buffer)
+        {
+                size_t base = alphabet.get_base();
+                size_t k { 0 };
+                while (true)
+                {
+                        std::shared_ptr<const Integer> power = BasicPowerCache<Integer>::instance().get_squared_power(base, k);
+                        if (*power > num)
+                                break;
+                        k++;
+                        if (std::numeric_limits<Integer>::is_bounded && 2 * (boost::multiprecision::msb(*power) + 1) > static_cast<size_t>(std::numeric_limits<Integer>::digits))
+                                break;
+                }
+                //num now has at most 2^k digits.
+                if (k == 0 || (static_cast<size_t>(1) << k) <= divide_and_conquer_format_threshold)
+                        write_integer_directly(num, alphabet, 0, output_buffer);
+                else
+                {
+                        Integer quotient;
+                        Integer remainder;
+                        boost::multiprecision::divide_qr(num, *BasicPowerCache<Integer>::instance().get_squared_power(base, k - 1), quotient, remainder);
+                        write_integer_padded(remainder, alphabet, k - 1, output_buffer);
+                        write_integer(quotient, alphabet, output_buffer);
+                }
+        }
+
+        //Converts an integer to a wstring in a given base.
+        std::wstring convert_integer_to_wstring(boost::multiprecision::cpp_int num, const Alphabet &alphabet)
+        {
+                OutputBuffer output_buffer(estimate_number_of_digits(num, alphabet.get_base()), 0);
+                write_integer(num, alphabet, output_buffer);
+                return output_buffer.str();
+        }
+
+        //Converts an integer to a wstring in a given base.
+        std::wstring convert_integer_to_wstring(boost::multiprecision::cpp_int num, std::wstring &char_set)
+        {
+                return convert_integer_to_wstring(num, Alphabet(char_set));
+        }
+
+        //Converts the digit values in [first, last), most significant first, to a NativeInteger. Their value must fit, which it always does if there are no more than alphabet.get_native_digits() of them.
+        //The digits which fit in a 64-bit word are gathered in one before moving to the wider type.
+        template <typename DigitValue>
+        NativeInteger convert_digit_values_to_native_integer(const std::pmr::vector<DigitValue> &digit_values, size_t first, size_t last, const Alphabet &alphabet)
+        {
+                size_t base = alphabet.get_base();
+                size_t word_end = std::min(last, first + alphabet.get_word_digits());
+                std::uint64_t word { 0 };
+                for (size_t i { first }; i < word_end; i++)
+                        word = word * base + digit_values[i];
+                NativeInteger num { word };
+                for (size_t i { word_end }; i < last; i++)
+                        num = num * base + digit_values[i];
+                return num;
+        }
+
+        //Writes a NativeInteger in a given base, of at least 2, to the front of an OutputBuffer, without leading zeroes. Zero writes nothing.
+        //Values above 64 bits are first split into words of alphabet.get_word_digits() digits. The digits of each word are found with the alphabet's WordDivisor, so no hardware division is made per digit.
+        template <typename CharT>
+        void write_native_integer(NativeInteger num, const Alphabet &alphabet, BasicOutputBuffer<CharT> &output_buffer)
+        {
+                std::uint64_t base = alphabet.get_base();
+                const WordDivisor &divisor = alphabet.get_divisor();
+                while (num > std::numeric_limits<std::uint64_t>::max())
+                {
+                        NativeInteger quotient = num / alphabet.get_word_power();
+                        std::uint64_t word = static_cast<std::uint64_t>(num - quotient * alphabet.get_word_power());
+                        for (size_t i { 0 }; i < alphabet.get_word_digits(); i++)
+                        {
+                                std::uint64_t word_quotient = divisor.divide(word);
+                                output_buffer.push_front(alphabet.get_digit(static_cast<size_t>(word - word_quotient * base)));
+                                word = word_quotient;
+                        }
+                        num = quotient;
+                }
+                std::uint64_t word = static_cast<std::uint64_t>(num);
+                while (word != 0)
+                {
+                        std::uint64_t word_quotient = divisor.divide(word);
+                        output_buffer.push_front(alphabet.get_digit(static_cast<size_t>(word - word_quotient * base)));
+                        word = word_quotient;
+                }
+        }
+
+        //Appends an integer to a vector in 32-bit digits, most significant first.
+        template <typename Integer>
+        void export_integer_bits(const Integer &num, std::pmr::vector<size_t> &bits)
+        {
+                size_t first = bits.size();
+                Integer remaining { num };
+                do
+                {
+                        Integer low_bits = remaining & 0xffffffffu;
+                        bits.push_back(static_cast<size_t>(static_cast<std::uint32_t>(low_bits)));
+                        remaining >>= 32;
+                } while (remaining != 0);
+                std::reverse(bits.begin() + first, bits.end());
+        }
+
+        //Appends an integer to a vector in 32-bit digits, most significant first. cpp_int backends export their limbs directly.
+        template <unsigned MinBits, unsigned MaxBits, boost::multiprecision::cpp_integer_type SignType, boost::multiprecision::cpp_int_check_type Checked, typename Allocator, boost::multiprecision::expression_template_option ExpressionTemplates>
+        void export_integer_bits(const boost::multiprecision::number<boost::multiprecision::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates> &num, std::pmr::vector<size_t> &bits)
+        {
+                boost::multiprecision::export_bits(num, std::back_inserter(bits), 32);
+        }
+
+        //Returns log2(base) if base is a power of two greater than 1, or 0 otherwise.
+        size_t get_bits_per_digit(size_t base)
+        {
+                if (base < 2 || (base & (base - 1)) != 0)
+                        return 0;
+                size_t bits { 0 };
+                while ((static_cast<size_t>(1) << bits) < base)
+                        bits++;
+                return bits;
+        }
+
+        //Writes an integer, given as the digit values in [first, last) most significant first in base 2^input_bits, to the front of an OutputBuffer in a power-of-two base, without leading zeroes.
+        //No arithmetic is needed: the bits of the input digits are regrouped from the least significant end into output digits. The result is the same as write_integer.
+        template <typename DigitValue, typename CharT>
+        void write_integer_by_bit_slicing(const std::pmr::vector<DigitValue> &digit_values, size_t first, size_t last, size_t input_bits, const Alphabet &alphabet, BasicOutputBuffer<CharT> &output_buffer)
+        {
+                size_t output_bits = get_bits_per_digit(alphabet.get_base());
+                std::uint64_t output_mask = (static_cast<std::uint64_t>(1) << output_bits) - 1;
+                size_t digits_written { 0 };
+                std::uint64_t bit_buffer { 0 };
+                size_t bits_in_buffer { 0 };
+                for (size_t i { last }; i > first; --i)
+                {
+                        bit_buffer |= static_cast<std::uint64_t>(digit_values[i-1]) << bits_in_buffer;
+                        bits_in_buffer += input_bits;
+                        //Once the most significant input digit is in, the zero bits left above it are not written.
+                        while (bits_in_buffer >= output_bits && (i > first + 1 || bit_buffer != 0))
+                        {
+                                output_buffer.push_front(alphabet.get_digit(static_cast<size_t>(bit_buffer & output_mask)));
+                                digits_written++;
+                                bit_buffer >>= output_bits;
+                                bits_in_buffer -= output_bits;
+                        }
+                }
+                if (bit_buffer != 0)
+                {
+                        output_buffer.push_front(alphabet.get_digit(static_cast<size_t>(bit_buffer)));
+                        digits_written++;
+                }
+                for (; digits_written > 0 && output_buffer.front() == alphabet.get_digit(0); digits_written--)
+                        output_buffer.pop_front();
+        }
+
+        //Writes a fraction, given as the digit values after the point in [first, last) in base 2^input_bits, to the back of an OutputBuffer as at most max_digits digits in a power-of-two base. Returns the number of digits written.
+        //The bits of the input digits are regrouped from the most significant end, so every digit is exact. Stops early once the rest of the fraction is zero.
+        template <typename DigitValue, typename CharT>
+        size_t write_fraction_by_bit_slicing(const std::pmr::vector<DigitValue> &digit_values, size_t first, size_t last, size_t input_bits, const Alphabet &alphabet, size_t max_digits, BasicOutputBuffer<CharT> &output_buffer)
+        {
+                size_t output_bits = get_bits_per_digit(alphabet.get_base());
+                size_t significant_digits = last;
+                while (significant_digits > first && digit_values[significant_digits - 1] == 0)
+                        significant_digits--;
+                size_t digits_written { 0 };
+                std::uint64_t bit_buffer { 0 };
+                size_t bits_in_buffer { 0 };
+                size_t i { first };
+                while (digits_written < max_digits && (i < significant_digits || bit_buffer != 0))
+                {
+                        while (bits_in_buffer < output_bits && i < significant_digits)
+                        {
+                                bit_buffer = (bit_buffer << input_bits) | static_cast<std::uint64_t>(digit_values[i]);
+                                bits_in_buffer += input_bits;
+                                i++;
+                        }
+                        if (bits_in_buffer < output_bits) //The input has run out, so the last output digit is padded with zero bits.
+                        {
+                                bit_buffer <<= (output_bits - bits_in_buffer);
+                                bits_in_buffer = output_bits;
+                        }
+                        bits_in_buffer -= output_bits;
+                        output_buffer.push_back(alphabet.get_digit(static_cast<size_t>(bit_buffer >> bits_in_buffer)));
+                        digits_written++;
+                        bit_buffer &= (static_cast<std::uint64_t>(1) << bits_in_buffer) - 1;
+                }
+                return digits_written;
+        }
+
+        //Returns the smallest root of a base, so that base = root^power, and sets power. E.g. 27 gives 3 with a power of 3, and 12 gives 12 with a power of 1. Returns 0 for bases below 2.
+        size_t find_smallest_root_of_base(size_t base, size_t &power)
+        {
+                power = 1;
+                if (base < 2)
+                        return 0;
+                for (size_t root { 2 }; root * root <= base; root++)
+                {
+                        size_t root_power { 1 };
+                        size_t value { root };
+                        while (value < base && value <= base / root)
+                        {
+                                value *= root;
+                                root_power++;
+                        }
+                        if (value == base)
+                        {
+                                power = root_power;
+                                return root;
+                        }
+                }
+                return base;
+        }
+
+        //Returns the smallest root of a base and sets power, as find_smallest_root_of_base. Bases below 256 are looked up in a table built on first use, as this is asked several times per conversion.
+        size_t get_smallest_root_of_base(size_t base, size_t &power)
+        {
+                static const std::array<std::pair<size_t, size_t>, 256> small_base_roots = []()
+                {
+                        std::array<std::pair<size_t, size_t>, 256> roots;
+                        for (size_t small_base { 0 }; small_base < roots.size(); small_base++)
+                                roots[small_base].first = find_smallest_root_of_base(small_base, roots[small_base].second);
+                        return roots;
+                }();
+                if (base >= small_base_roots.size())
+                        return find_smallest_root_of_base(base, power);
+                power = small_base_roots[base].second;
+                return small_base_roots[base].first;
+        }
+
+        //Returns the natural logarithm of a base. Bases below 256 are looked up in a table built on first use, as output lengths are estimated from it for every conversion.
+        double get_log_of_base(size_t base)
+        {
+                static const std::array<double, 256> small_base_logs = []()
+                {
+                        std::array<double, 256> logs;
+                        for (size_t small_base { 0 }; small_base < logs.size(); small_base++)
+                                logs[small_base] = std::log(static_cast<double>(small_base));
+                        return logs;
+                }();
+                if (base >= small_base_logs.size())
+                        return std::log(static_cast<double>(base));
+                return small_base_logs[base];
+        }
+
+        //The distinct prime factors of a number, smallest first, and the power of each. A 64-bit number has at most 15 distinct prime factors.
+        struct PrimeFactors
+        {
+                std::array<std::uint64_t, 15>   primes {};
+                std::array<size_t, 15>          powers {};
+                size_t                          count {0};
+
+                //The power of prime in the number, 0 if it is not a factor.
+                size_t get_power(std::uint64_t prime) const
+                {
+                        for (size_t i { 0 }; i < count; i++)
+                                if (primes[i] == prime)
+                                        return powers[i];
+                        return 0;
+                }
+        };
+
+        //Factorizes a number by trial division. Only used on bases, which are small.
+        PrimeFactors factorize(std::uint64_t number)
+        {
+                PrimeFactors factors;
+                for (std::uint64_t prime { 2 }; prime <= number / prime; prime++)
+                {
+                        if (number % prime != 0)
+                                continue;
+                        factors.primes[factors.count] = prime;
+                        while (number % prime == 0)
+                        {
+                                number /= prime;
+                                factors.powers[factors.count]++;
+                        }
+                        factors.count++;
+                }
+                if (number > 1)
+                {
+                        factors.primes[factors.count] = number;
+                        factors.powers[factors.count] = 1;
+                        factors.count++;
+                }
+                return factors;
+        }
+
+        //Returns the multiplicative order of base modulo prime^power, which is the length of the repetend of 1 / prime^power in that base, or 0 if it is above limit. The prime must not divide the base.
+        //The order modulo the prime is found by stepping through the powers of the base. The order modulo prime^power is that times a power of the prime, found by raising to the prime until the power of the base leaves 1.
+        //base^order - 1 has fewer than order * log(base) / log(prime) factors of the prime, so a higher power is known to give an order above limit without any big integer being built.
+        std::uint64_t get_multiplicative_order(std::uint64_t base, std::uint64_t prime, size_t power, std::uint64_t limit)
+        {
+                std::uint64_t order { 1 };
+                std::uint64_t residue = base % prime;
+                for (std::uint64_t base_power { residue }; base_power != 1; base_power = static_cast<std::uint64_t>(static_cast<NativeInteger>(base_power) * residue % prime))
+                        if (++order > limit)
+                                return 0;
+                double log_of_prime = std::log(static_cast<double>(prime));
+                if (static_cast<double>(power) > (static_cast<double>(order) * get_log_of_base(base) + std::log(static_cast<double>(limit))) / log_of_prime + 1)
+                        return 0;
+                boost::multiprecision::cpp_int modulus = boost::multiprecision::pow(boost::multiprecision::cpp_int(prime), static_cast<unsigned int>(power));
+                boost::multiprecision::cpp_int base_power = boost::multiprecision::powm(boost::multiprecision::cpp_int(base), order, modulus);
+                while (base_power != 1)
+                {
+                        order *= prime;
+                        if (order > limit)
+                                return 0;
+                        base_power = boost::multiprecision::powm(base_power, prime, modulus);
+                }
+                return order;
+        }
+
+        //Builds a table with the expansion of every digit value in base root^power into power digits in base root, most significant first.
+        std::pmr::vector<size_t> build_root_digit_table(size_t root, size_t power)
+        {
+                size_t base { 1 };
+                for (size_t i { 0 }; i < power; i++)
+                        base *= root;
+                std::pmr::vector<size_t> root_digit_table(base * power, get_thread_memory_resource());
+                for (size_t value { 0 }; value < base; value++)
+                {
+                        size_t remaining_value = value;
+                        for (size_t j { power }; j > 0; --j)
+                        {
+                                root_digit_table[value * power + j - 1] = remaining_value % root;
+                                remaining_value /= root;
+                        }
+                }
+                return root_digit_table;
+        }
+
+        //Returns the table of build_root_digit_table for root and power, building it on first use. The tables are kept for the life of the process and shared by every thread, so, like the powers in the PowerCache, they are allocated from new and delete and read under a shared lock.
+        const std::pmr::vector<size_t> &get_root_digit_table(size_t root, size_t power)
+        {
+                static std::shared_mutex mutex;
+                static boost::container::flat_map<std::pair<size_t, size_t>, std::unique_ptr<const std::pmr::vector<size_t>>> root_digit_tables;
+                {
+                        std::shared_lock<std::shared_mutex> lock(mutex);
+                        auto it = root_digit_tables.find(std::make_pair(root, power));
+                        if (it != root_digit_tables.end())
+                                return *it->second;
+                }
+                MemoryResourceScope memory_resource_scope(std::pmr::new_delete_resource());
+                std::unique_ptr<const std::pmr::vector<size_t>> root_digit_table = std::make_unique<const std::pmr::vector<size_t>>(build_root_digit_table(root, power));
+                std::unique_lock<std::shared_mutex> lock(mutex);
+                auto inserted = root_digit_tables.emplace(std::make_pair(root, power), std::move(root_digit_table));
+                return *inserted.first->second;
+        }
+
+        //Writes an integer, given as the digit values in [first, last) most significant first in base root^input_power, to the front of an OutputBuffer in base root^output_power, without leading zeroes.
+        //Each input digit is expanded into input_power root digits from a table, and every output_power root digits, counted from the least significant end, make one output digit. The result is the same as write_integer.
+        template <typename DigitValue, typename CharT>
+        void write_integer_by_regrouping(const std::pmr::vector<DigitValue> &digit_values, size_t first, size_t last, size_t root, size_t input_power, size_t output_power, const Alphabet &alphabet, BasicOutputBuffer<CharT> &output_buffer)
+        {
+                const std::pmr::vector<size_t> &root_digit_table = get_root_digit_table(root, input_power);
+                size_t digits_written { 0 };
+                size_t root_digits_in_group { 0 };
+                size_t place_value { 1 };
+                size_t group_value { 0 };
+                for (size_t i { last }; i > first; --i)
+                {
+                        for (size_t j { input_power }; j > 0; --j)
+                        {
+                                group_value += root_digit_table[digit_values[i-1] * input_power + j - 1] * place_value;
+                                place_value *= root;
+                                if (++root_digits_in_group == output_power)
+                                {
+                                        output_buffer.push_front(alphabet.get_digit(group_value));
+                                        digits_written++;
+                                        group_value = 0;
+                                        place_value = 1;
+                                        root_digits_in_group = 0;
+                                }
+                        }
+                }
+                if (root_digits_in_group > 0) //The most significant group is short, i.e. padded with leading zero root digits.
+                {
+                        output_buffer.push_front(alphabet.get_digit(group_value));
+                        digits_written++;
+                }
+                for (; digits_written > 0 && output_buffer.front() == alphabet.get_digit(0); digits_written--)
+                        output_buffer.pop_front();
+        }
+
+        //Writes a fraction, given as the digit values after the point in [first, last) in base root^input_power, to the back of an OutputBuffer as at most max_digits digits in base root^output_power. Returns the number of digits written.
+        //The root digits of the input are regrouped from the most significant end, so every digit is exact. Stops early once the rest of the fraction is zero.
+        template <typename DigitValue, typename CharT>
+        size_t write_fraction_by_regrouping(const std::pmr::vector<DigitValue> &digit_values, size_t first, size_t last, size_t root, size_t input_power, size_t output_power, const Alphabet &alphabet, size_t max_digits, BasicOutputBuffer<CharT> &output_buffer)
+        {
+                const std::pmr::vector<size_t> &root_digit_table = get_root_digit_table(root, input_power);
+                size_t significant_digits = last;
+                while (significant_digits > first && digit_values[significant_digits - 1] == 0)
+                        significant_digits--;
+                size_t digits_written { 0 };
+                size_t root_digits_in_group { 0 };
+                size_t group_value { 0 };
+                for (size_t i { first }; i < significant_digits && digits_written < max_digits; i++)
+                {
+                        for (size_t j { 0 }; j < input_power && digits_written < max_digits; j++)
+                        {
+                                group_value = group_value * root + root_digit_table[digit_values[i] * input_power + j];
+                                if (++root_digits_in_group == output_power)
+                                {
+                                        output_buffer.push_back(alphabet.get_digit(group_value));
+                                        digits_written++;
+                                        group_value = 0;
+                                        root_digits_in_group = 0;
+                                }
+                        }
+                }
+                if (root_digits_in_group > 0 && digits_written < max_digits) //The last group is padded with trailing zero root digits.
+                {
+                        for (; root_digits_in_group < output_power; root_digits_in_group++)
+                                group_value *= root;
+                        output_buffer.push_back(alphabet.get_digit(group_value));
+                        digits_written++;
+                }
+                if (digits_written < max_digits)
+                {
+                        for (; digits_written > 0 && output_buffer.back() == alphabet.get_digit(0); digits_written--)
+                                output_buffer.pop_back();
+                }
+                return digits_written;
         }
 
+        //Errors which stop a conversion. They are recorded as codes, and their messages are only formatted when asked for.
+        enum class ConversionError
+        {
+                input_digits_repeated, //The input character set has repeat characters.
+                output_digits_repeated, //The output character set has repeat characters.
+                input_format_invalid, //The input has illegal characters, or a missing, repeated or misplaced decimal point.
+                input_too_large, //The integer part of the input does not fit in the bounded integer type of the BasicBaseConversion.
+                allocation_failed, //Memory for the digits of the input could not be allocated. Only recorded by try_input, as input throws std::bad_alloc instead.
+        };
+
+        //Warnings which do not stop a conversion.
+        enum class ConversionWarning
+        {
+                float_precision_illegal, //A float precision below 1 was requested.
+                repetend_too_long, //With repetend detection, the repeating digits are longer than repetend_length_limit, so the float was rounded to the precision instead.
+                repetend_notation_ambiguous, //With repetend notation, the output digits include a bracket, so the float was rounded to the precision instead.
+        };
+
+        //A set of ConversionErrors or ConversionWarnings, held as bit flags so that recording one never allocates.
+        template <typename Flag>
+        class FlagSet
+        {
+        public:
+                void insert(Flag flag)
+                {
+                        flags |= get_bit(flag);
+                }
+
+                bool contains(Flag flag) const
+                {
+                        return (flags & get_bit(flag)) != 0;
+                }
+
+                bool empty() const
+                {
+                        return flags == 0;
+                }
+
+                void clear()
+                {
+                        flags = 0;
+                }
+
+        private:
+                std::uint32_t   flags {0};
+
+                static std::uint32_t get_bit(Flag flag)
+                {
+                        return static_cast<std::uint32_t>(1) << static_cast<unsigned int>(flag);
+                }
+        };
+
+        typedef FlagSet<ConversionError> ConversionErrorSet;
+        typedef FlagSet<ConversionWarning> ConversionWarningSet;
+
+        //Returns the message of an error.
+        const char *get_error_message(ConversionError error)
+        {
+                switch (error)
+                {
+                case ConversionError::input_digits_repeated:
+                case ConversionError::output_digits_repeated:
+                        return "The inputted set of digits contains repeat characters. To be used for base conversion, every character must be unique.";
+                case ConversionError::input_format_invalid:
+                        return "Input string does not match formatting requirements. It may have illegal characters, or it may have more than one decimal point or a decimal point in the wrong place.";
+                case ConversionError::input_too_large:
+                        return "The integer part of the input is too large for the integer type used for the conversion.";
+                case ConversionError::allocation_failed:
+                        return "Memory for the input could not be allocated.";
+                }
+                return "";
+        }
+
+        //Returns the message of a warning. The output base is only used by repetend_too_long.
+        std::string get_warning_message(ConversionWarning warning, unsigned int output_base = 0)
+        {
+                switch (warning)
+                {
+                case ConversionWarning::float_precision_illegal:
+                        return "Warning: Illegal float precision. Try again with a float precision of at least 1.";
+                case ConversionWarning::repetend_too_long:
+                        return "The repeating digits of the float are longer than " + std::to_string(repetend_length_limit) + " digits in base " + std::to_string(output_base) + ". The float has been rounded to the precision instead.";
+                case ConversionWarning::repetend_notation_ambiguous:
+                        return "The output digits include a bracket, so the repeating digits of the float cannot be shown in brackets. The float has been rounded to the precision instead.";
+                }
+                return "";
+        }
+
+        //Thrown for errors and warnings by a BaseConversion which was given throw_exception = true.
+        class ConversionException : public std::exception
+        {
+        public:
+                ConversionException(ConversionError error) : error(error), message(get_error_message(error))
+                {
+                        //No action.
+                }
+
+                ConversionException(ConversionWarning warning, std::string warning_message) : warning_thrown(true), warning(warning), message(warning_message)
+                {
+                        //No action.
+                }
+
+                const char *what() const noexcept override
+                {
+                        return message.c_str();
+                }
+
+                //Whether a warning, rather than an error, was thrown.
+                bool is_warning() const
+                {
+                        return warning_thrown;
+                }
+
+                //The error thrown, if not a warning.
+                ConversionError get_error() const
+                {
+                        return error;
+                }
+
+                //The warning thrown, if a warning.
+                ConversionWarning get_warning() const
+                {
+                        return warning;
+                }
+
+        private:
+                bool                    warning_thrown {false};
+                ConversionError         error {};
+                ConversionWarning       warning {};
+                std::string             message;
+        };
+
         //ConversionReturn is the preferred form of return of the BaseConversion object.
         struct ConversionReturn
         {
-                bool                            errors_encountered; //Whether errors were encountered in the conversion.
-                bool                            warnings_encountered; //Whether warnings were encountered in the conversion.
-                std::vector<std::string>        errors; //Vector of errors encountered.
-                std::vector<std::string>        warnings; //Vector of warnings encountered.
-                std::wstring                    before_point; //The part of the output before the decimal point.
-                std::wstring                    after_point; //The part of the output after the decimal point, if output is a float.
-                wchar_t                         decimal_point_used; //The character used to indicate a decimal point, if output is a float.
-                std::wstring                    output; //The whole of the output, converted.
-                std::wstring                    input_digits; //The digit set which defines the input.
-                std::wstring                    output_digits; //The digit set which defines the output.
-                unsigned int                    input_base; //The number of digits in the input base.
-                unsigned int                    output_base; //The number of digits in the output base.
-                bool                            output_base_allows_use_uppercase; //Whether the output base allows the use of conversion of letter digits to uppercase.
+                typedef std::pmr::polymorphic_allocator<wchar_t> allocator_type; //The strings are allocated with it, so that a ConversionReturn can live in a memory resource.
+
+                bool                            errors_encountered {false}; //Whether errors were encountered in the conversion.
+                bool                            warnings_encountered {false}; //Whether warnings were encountered in the conversion.
+                ConversionErrorSet              errors; //Set of errors encountered. Their messages are given by get_error_messages().
+                ConversionWarningSet            warnings; //Set of warnings encountered. Their messages are given by get_warning_messages().
+                std::pmr::wstring               before_point; //The part of the output before the decimal point.
+                std::pmr::wstring               after_point; //The part of the output after the decimal point, if output is a float.
+                wchar_t                         decimal_point_used {0}; //The character used to indicate a decimal point, if output is a float.
+                std::pmr::wstring               output; //The whole of the output, converted.
+                std::pmr::wstring               input_digits; //The digit set which defines the input.
+                std::pmr::wstring               output_digits; //The digit set which defines the output.
+                unsigned int                    input_base {0}; //The number of digits in the input base.
+                unsigned int                    output_base {0}; //The number of digits in the output base.
+                bool                            output_base_allows_use_uppercase {false}; //Whether the output base allows the use of conversion of letter digits to uppercase.
                 bool                            output_uppercase_used {false}; //Whether a conversion of letter digits to uppercase was in fact made.
-                bool                            is_float; //Whether the input and output are floats. False = input and output are integers.
-                unsigned int                    max_precision; //The maximum precision after the floating point of the selected output base, if a float.
-                unsigned int                    precision; //The actual precision used in the output, if a float. May be more than the number of digits after the floating point if further digits were not needed.
-                bool                            rounded; //Whether the output, if a float, had to be rounded to fit within the precision.
-        };
-
-        //Validation return carries information about whether a character set has been validated, and any errors which were encountered.
-        struct ValidationReturn
-        {
-                bool valid; //Whether the inputted item has been validated.
-                std::vector<std::string> error_messages; //Any error messages created during the validation.
+                bool                            is_float {false}; //Whether the input and output are floats. False = input and output are integers.
+                unsigned int                    max_precision {0}; //The maximum precision after the floating point of the selected output base, if a float. There is no limit, so it is always the largest unsigned int.
+                unsigned int                    precision {0}; //The actual precision used in the output, if a float. May be more than the number of digits after the floating point if further digits were not needed.
+                bool                            rounded {false}; //Whether the output, if a float, had to be rounded to fit within the precision.
+                bool                            repetend_found {false}; //Whether the exact digits after the point were found as prefix and repetend. Only with repetend detection, for floats.
+                std::pmr::wstring               prefix; //The digits after the point which come before the repetend, if repetend_found. All the digits after the point if the float ends.
+                std::pmr::wstring               repetend; //The digits after prefix which repeat forever, once, if repetend_found. Empty if the float ends.
+
+                ConversionReturn()
+                {
+                        //No action.
+                }
+
+                //Construct an empty ConversionReturn whose strings are allocated with allocator.
+                explicit ConversionReturn(const allocator_type &allocator) : before_point(allocator), after_point(allocator), output(allocator), input_digits(allocator), output_digits(allocator), prefix(allocator), repetend(allocator)
+                {
+                        //No action.
+                }
+
+                ConversionReturn(const ConversionReturn &other) = default;
+                ConversionReturn(ConversionReturn &&other) = default;
+
+                //Copy or move into strings allocated with allocator. Containers of ConversionReturns with a std::pmr allocator use these.
+                ConversionReturn(const ConversionReturn &other, const allocator_type &allocator) : ConversionReturn(allocator)
+                {
+                        *this = other;
+                }
+
+                ConversionReturn(ConversionReturn &&other, const allocator_type &allocator) : ConversionReturn(allocator)
+                {
+                        *this = std::move(other);
+                }
+
+                ConversionReturn &operator=(const ConversionReturn &other) = default;
+                ConversionReturn &operator=(ConversionReturn &&other) = default;
+
+                allocator_type get_allocator() const
+                {
+                        return output.get_allocator();
+                }
+
+                //The messages of the errors encountered, formatted on request.
+                std::vector<std::string> get_error_messages() const
+                {
+                        std::vector<std::string> messages;
+                        for (ConversionError error : {ConversionError::input_digits_repeated, ConversionError::output_digits_repeated, ConversionError::input_format_invalid, ConversionError::input_too_large, ConversionError::allocation_failed})
+                                if (errors.contains(error))
+                                        messages.push_back(get_error_message(error));
+                        return messages;
+                }
+
+                //The messages of the warnings encountered, formatted on request.
+                std::vector<std::string> get_warning_messages() const
+                {
+                        std::vector<std::string> messages;
+                        for (ConversionWarning warning : {ConversionWarning::float_precision_illegal, ConversionWarning::repetend_too_long, ConversionWarning::repetend_notation_ambiguous})
+                                if (warnings.contains(warning))
+                                        messages.push_back(get_warning_message(warning, output_base));
+                        return messages;
+                }
         };
 
-        //Defines a special float type with the largest precision possible.
-	typedef boost::multiprecision::number<boost::multiprecision::cpp_dec_float<1800> > cpp_dec_float_huge;
+        //The outcome of BaseConversion::convert_into.
+        enum class ConversionStatus
+        {
+                success,
+                invalid_input, //The input number or its character set has errors.
+                invalid_output_alphabet, //The output character set has repeat characters.
+                output_alphabet_not_ascii, //The output character set has non-ASCII digits, which cannot be written one per char.
+                output_too_small, //The output storage holds fewer characters than required_size().
+                allocation_failed, //Memory for the integers or the cache of powers could not be allocated. Only returned by try_convert_into.
+        };
+
+        //ConvertIntoReturn is returned by BaseConversion::convert_into.
+        struct ConvertIntoReturn
+        {
+                size_t                          characters_written; //The number of characters written to the start of the output storage. No terminating null is written.
+                ConversionStatus                status;
+        };
 
-	class BaseConversion
+	//BasicBaseConversion converts numbers with the integer part held in Integer, which can be any Boost.Multiprecision integer type: cpp_int (the default, see BaseConversion), cpp_int with a custom allocator,
+	//a fixed-width number<cpp_int_backend<N, N, unsigned_magnitude, unchecked>> which never allocates, or another backend such as gmp_int. Inputs whose integer part does not fit in a bounded Integer are rejected with input_too_large.
+	//The part after the point is always held in cpp_int, as its size is set by the precision rather than by the input.
+	//Given a std::pmr::memory_resource, the digit vectors, the output buffers and the strings of every ConversionReturn are allocated from it, as are the limbs of an Integer which uses ResourceAllocator (see PmrBaseConversion).
+	//A std::pmr::monotonic_buffer_resource per request can then release everything at once. The resource must outlive the BaseConversion and the ConversionReturns it gives.
+	//The integers of the part after the point are plain cpp_int whatever Integer is, so a fraction too long for their inline limbs allocates from the global heap.
+	template <typename Integer>
+	class BasicBaseConversion
 	{
 	public:
 		//Construct with a std::wstring encoded number, and an AnyBaseConversion defined Base.
-		BaseConversion(std::wstring &number_s, Base base, bool throw_exception = false)
+		BasicBaseConversion(std::wstring_view number_w, Base base, bool throw_exception = false)
+		{
+			input(number_w, base, throw_exception);
+		}
+
+                //Construct with a std::wstring encoded number and a user-defined std::wstring definition of the numbering.
+		BasicBaseConversion(std::wstring_view number_w, std::wstring_view digits_w, bool throw_exception = false)
+		{
+			input(number_w, digits_w, throw_exception);
+		}
+
+                //Construct with a std::wstring encoded number and a prebuilt Alphabet.
+		BasicBaseConversion(std::wstring_view number_w, const Alphabet &alphabet, bool throw_exception = false)
+		{
+			input(number_w, alphabet, throw_exception);
+		}
+
+                //Construct with a UTF-8 std::string encoded number, and an AnyBaseConversion defined Base.
+		BasicBaseConversion(std::string_view number_s, Base base, bool throw_exception = false)
 		{
 			input(number_s, base, throw_exception);
 		}
 
-                //Construct with a std::wstring encoded number and a user-defined std::wstring definition of the numbering.
-		BaseConversion(std::wstring &number_s, std::wstring &digits, bool throw_exception = false)
+                //Construct with a UTF-8 std::string encoded number and a user-defined std::string definition of the numbering.
+		BasicBaseConversion(std::string_view number_s, std::string_view digits, bool throw_exception = false)
+		{
+			input(number_s, digits, throw_exception);
+		}
+
+                //Construct with a UTF-8 std::string encoded number and a prebuilt Alphabet.
+		BasicBaseConversion(std::string_view number_s, const Alphabet &alphabet, bool throw_exception = false)
+		{
+			input(number_s, alphabet, throw_exception);
+		}
+
+                //Construct with a UTF-32 std::u32string encoded number, and an AnyBaseConversion defined Base.
+		BasicBaseConversion(std::u32string_view number_u32, Base base, bool throw_exception = false)
+		{
+			input(number_u32, base, throw_exception);
+		}
+
+                //Construct with a UTF-32 std::u32string encoded number and a user-defined std::u32string definition of the numbering.
+		BasicBaseConversion(std::u32string_view number_u32, std::u32string_view digits_u32, bool throw_exception = false)
+		{
+			input(number_u32, digits_u32, throw_exception);
+		}
+
+                //Construct with a UTF-32 std::u32string encoded number and a prebuilt Alphabet.
+		BasicBaseConversion(std::u32string_view number_u32, const Alphabet &alphabet, bool throw_exception = false)
+		{
+			input(number_u32, alphabet, throw_exception);
+		}
+
+                //Construct an empty object.
+		BasicBaseConversion()
+		{
+			//No action.
+		}
+
+                //Construct an empty object which allocates from a memory resource.
+		explicit BasicBaseConversion(std::pmr::memory_resource *resource) : memory_resource(resource)
+		{
+			//No action.
+		}
+
+		//The memory resource which this BaseConversion allocates from.
+		std::pmr::memory_resource *get_memory_resource() const
+		{
+			return memory_resource;
+		}
+
+                //Input a std::wstring number and an AnyBaseConversion::Base to an empty BaseConversion, or overwrite the existing user input if not empty.
+		//Letter digits of bases which allow uppercase (e.g. hexadecimal) are accepted in either case.
+		void input(std::wstring_view number_w, Base base, bool throw_exception = false)
+		{
+			input(number_w, get_alphabet_from_base(base), throw_exception);
+		}
+
+		//Input a std::wstring number and a user-defined std::wstring numbering definition to an empty BaseConversion, or overwrite the existing user input if not empty.
+		void input(std::wstring_view number_w, std::wstring_view digits_w, bool throw_exception = false)
+		{
+			input(number_w, Alphabet(digits_w), throw_exception);
+		}
+
+		//Input a std::wstring number and a prebuilt Alphabet to an empty BaseConversion, or overwrite the existing user input if not empty. The Alphabet is not validated again.
+		void input(std::wstring_view number_w, const Alphabet &alphabet, bool throw_exception = false)
+		{
+			if (throw_exception)
+				use_exceptions = true;
+                        load_number(number_w, alphabet);
+		}
+
+                //Input a UTF-8 std::string number and an AnyBaseConversion::Base to an empty BaseConversion, or overwrite the existing user input if not empty.
+                void input(std::string_view number_s, Base base, bool throw_exception = false)
+                {
+			input(number_s, get_alphabet_from_base(base), throw_exception);
+                }
+
+                //Input a UTF-8 std::string number and a user-defined std::string numbering definition to an empty BaseConversion, or overwrite the existing user input if not empty.
+		void input(std::string_view number_s, std::string_view digits, bool throw_exception = false)
+		{
+			input(number_s, Alphabet(digits), throw_exception);
+		}
+
+                //Input a UTF-8 std::string number and a prebuilt Alphabet to an empty BaseConversion, or overwrite the existing user input if not empty. The Alphabet is not validated again.
+		//The number is read byte by byte when the Alphabet is ASCII, and only transcoded to a wstring otherwise.
+		void input(std::string_view number_s, const Alphabet &alphabet, bool throw_exception = false)
+		{
+			if (throw_exception)
+				use_exceptions = true;
+                        load_number(number_s, alphabet);
+		}
+
+                //Input a UTF-32 std::u32string number and an AnyBaseConversion::Base to an empty BaseConversion, or overwrite the existing user input if not empty.
+                void input(std::u32string_view number_u32, Base base, bool throw_exception = false)
+                {
+			input(number_u32, get_alphabet_from_base(base), throw_exception);
+                }
+
+                //Input a UTF-32 std::u32string number and a user-defined std::u32string numbering definition to an empty BaseConversion, or overwrite the existing user input if not empty.
+		void input(std::u32string_view number_u32, std::u32string_view digits_u32, bool throw_exception = false)
+		{
+			input(number_u32, Alphabet(digits_u32), throw_exception);
+		}
+
+                //Input a UTF-32 std::u32string number and a prebuilt Alphabet to an empty BaseConversion, or overwrite the existing user input if not empty. The Alphabet is not validated again.
+		void input(std::u32string_view number_u32, const Alphabet &alphabet, bool throw_exception = false)
+		{
+			if (throw_exception)
+				use_exceptions = true;
+                        load_number(number_u32, alphabet);
+		}
+
+		//try_input is a noexcept form of input, for untrusted numbers. It never throws, even if an earlier input asked for exceptions, and returns the set of errors found, which is empty if the number was accepted.
+		//Rejecting a number records only error codes, so once the BaseConversion has held a number of the same length it does not allocate.
+
+		//Input a UTF-8 std::string number and a prebuilt Alphabet without throwing.
+		ConversionErrorSet try_input(std::string_view number_s, const Alphabet &alphabet) noexcept
+		{
+			return try_load_number(number_s, alphabet);
+		}
+
+		//Input a std::wstring number and a prebuilt Alphabet without throwing.
+		ConversionErrorSet try_input(std::wstring_view number_w, const Alphabet &alphabet) noexcept
+		{
+			return try_load_number(number_w, alphabet);
+		}
+
+		//Input a UTF-32 std::u32string number and a prebuilt Alphabet without throwing.
+		ConversionErrorSet try_input(std::u32string_view number_u32, const Alphabet &alphabet) noexcept
+		{
+			return try_load_number(number_u32, alphabet);
+		}
+
+		//Set the precision (maximum number of digits after the decimal point) of the output float (if it is a float). A precision below 1 is ignored with a warning, as there is no maximum to fall back on.
+		void set_float_precision(int precision_given)
+		{
+			if (precision_given < 1)
+			{
+                                set_warning(ConversionWarning::float_precision_illegal);
+                                return;
+			}
+			precision_requested = precision_given;
+                        float_precision_set = true;
+		}
+
+		//Turn repetend detection on or off. With it, the digits after the point of a float are also found exactly, as a prefix followed by a repetend which repeats forever, and given in the prefix and repetend of the ConversionReturn.
+		//E.g. 0.1 in decimal is 0.(0022) in ternary and 0.1(2497) in duodecimal. With use_notation, the output is written in that form in place of the digits to the precision, so the digits generated are bounded by the period rather than by the precision.
+		void set_repetend_detection(bool detect_repetend, bool use_notation = false)
+		{
+			repetend_detection = detect_repetend;
+			repetend_notation = detect_repetend && use_notation;
+		}
+
+                //Output the number as a string in a defined base. If an error occurs, will output an empty string: "".
+                //Allows some defined bases (e.g. hexadecimal) to convert digits which are letters to uppercase. Only available for those bases which already use lowercase letters but no uppercase letters as digits.
+		std::string output_string(Base base, bool use_uppercase = false)
+		{
+			if (!does_base_allow_use_uppercase(base))
+				use_uppercase = false;
+			return generate_string(get_alphabet_from_base(base), use_uppercase, true);
+		}
+
+		//Output the number as a UTF-8 string in a user-defined base. If an error occurs, will output an empty string: "".
+		std::string output_string(std::string_view digits)
+		{
+                        return generate_string(Alphabet(digits));
+		}
+
+		//Output the number as a UTF-8 string in the base of a prebuilt Alphabet. If an error occurs, will output an empty string: "".
+		//The digits of ASCII alphabets are written into a char buffer and copied from it into the string, without a wstring in between.
+		std::string output_string(const Alphabet &alphabet)
+		{
+                        return generate_string(alphabet);
+		}
+
+		//Output the number as a wstring in a defined base. If an error occurs, will output an empty string: "".
+		std::wstring output_wstring(Base base, bool use_uppercase = false)
+		{
+			ConversionReturn conversion_return = generate_conversion_return(base, use_uppercase);
+			return std::wstring(conversion_return.output);
+		}
+
+                //Output the number as a wstring in a user-defined base. If an error occurs, will output an empty string: "".
+		std::wstring output_wstring(std::wstring_view digits_w)
+		{
+                        ConversionReturn conversion_return = generate_conversion_return(Alphabet(digits_w));
+                        return std::wstring(conversion_return.output);
+		}
+
+                //Output the number as a wstring in the base of a prebuilt Alphabet. If an error occurs, will output an empty string: "".
+		std::wstring output_wstring(const Alphabet &alphabet)
+		{
+                        ConversionReturn conversion_return = generate_conversion_return(alphabet);
+                        return std::wstring(conversion_return.output);
+		}
+
+		//It is recommended that you always get the return as a ConversionReturn. This will allow you to know if any errors or warnings occurred.
+
+		//Output the number as a ConversionReturn in a defined base.
+		AnyBaseConversion::ConversionReturn output_conversion_return(Base base, bool use_uppercase = false)
+		{
+		        ConversionReturn conversion_return = generate_conversion_return(base, use_uppercase);
+		        return conversion_return;
+		}
+
+                //Output the number as a ConversionReturn in a user-defined wstring base.
+		AnyBaseConversion::ConversionReturn output_conversion_return(std::wstring_view digits_w)
+		{
+		        ConversionReturn conversion_return = generate_conversion_return(Alphabet(digits_w));
+		        return conversion_return;
+		}
+
+                //Output the number as a ConversionReturn in a user-defined UTF-8 string base.
+		AnyBaseConversion::ConversionReturn output_conversion_return(std::string_view digits)
+		{
+		        ConversionReturn conversion_return = generate_conversion_return(Alphabet(digits));
+		        return conversion_return;
+		}
+
+                //Output the number as a ConversionReturn in the base of a prebuilt Alphabet.
+		AnyBaseConversion::ConversionReturn output_conversion_return(const Alphabet &alphabet)
+		{
+		        ConversionReturn conversion_return = generate_conversion_return(alphabet);
+		        return conversion_return;
+		}
+
+		//convert_into writes the number into out_size characters of caller-owned char or wchar_t storage, and returns the number of characters written and a ConversionStatus. It builds no strings,
+		//so once the PowerCache holds the powers it needs it does not allocate for numbers of up to 128 bits. The storage must hold at least required_size() characters for the same output base.
+
+		//Write the number in a defined base into caller-owned storage.
+		template <typename CharT>
+		ConvertIntoReturn convert_into(CharT *out, size_t out_size, Base base, bool use_uppercase = false)
+		{
+			if (!does_base_allow_use_uppercase(base))
+				use_uppercase = false;
+			return convert_into_storage(out, out_size, get_alphabet_from_base(base), use_uppercase);
+		}
+
+		//Write the number in the base of a prebuilt Alphabet into caller-owned storage.
+		template <typename CharT>
+		ConvertIntoReturn convert_into(CharT *out, size_t out_size, const Alphabet &alphabet)
+		{
+			return convert_into_storage(out, out_size, alphabet, false);
+		}
+
+		//A noexcept form of convert_into. Never throws, even if an earlier input asked for exceptions. Failure to allocate is returned as ConversionStatus::allocation_failed.
+		template <typename CharT>
+		ConvertIntoReturn try_convert_into(CharT *out, size_t out_size, const Alphabet &alphabet) noexcept
+		{
+			bool exceptions_requested = use_exceptions;
+			use_exceptions = false;
+			ConvertIntoReturn convert_into_return {0, ConversionStatus::allocation_failed};
+			try
+			{
+				convert_into_return = convert_into_storage(out, out_size, alphabet, false);
+			}
+			catch (...)
+			{
+				//With exceptions turned off, only allocations can throw.
+			}
+			use_exceptions = exceptions_requested;
+			return convert_into_return;
+		}
+
+		//The number of characters of storage convert_into needs for a defined base. An upper bound worked out from the input length and the two bases, including room for the extra digit used in rounding.
+		size_t required_size(Base base)
+		{
+			return required_size(get_alphabet_from_base(base));
+		}
+
+		//The number of characters of storage convert_into needs for the base of a prebuilt Alphabet.
+		size_t required_size(const Alphabet &alphabet)
+		{
+			ConversionReturn conversion_return = get_conversion_info(alphabet);
+			return estimate_integer_length(conversion_return) + estimate_fraction_length(conversion_return);
+		}
+
+		//output_many outputs the number in several bases in one call, returning a ConversionReturn for each, in the same order. Each ConversionReturn is the same as output_conversion_return would give.
+		//The work is shared: the integer is parsed once, all power-of-two bases are sliced from the same bits, bases which are powers of a common root (e.g. 3 and 9, or 6 and 36) are regrouped from the digits of the largest of them,
+		//and every fraction is expanded from the same parsed value.
+
+		//Output the number as ConversionReturns in several defined bases. use_uppercase applies to those bases which allow it.
+		std::pmr::vector<ConversionReturn> output_many(const std::vector<Base> &bases, bool use_uppercase = false)
+		{
+			std::pmr::vector<const Alphabet *> output_alphabets(memory_resource);
+			std::pmr::vector<bool> uppercase_used(memory_resource);
+			for (Base base : bases)
+			{
+				output_alphabets.push_back(&get_alphabet_from_base(base));
+				uppercase_used.push_back(use_uppercase && does_base_allow_use_uppercase(base));
+			}
+			return generate_conversion_returns(output_alphabets, uppercase_used);
+		}
+
+		//Output the number as ConversionReturns in the bases of several prebuilt Alphabets.
+		std::pmr::vector<ConversionReturn> output_many(const std::vector<Alphabet> &alphabets)
+		{
+			std::pmr::vector<const Alphabet *> output_alphabets(memory_resource);
+			for (const Alphabet &alphabet : alphabets)
+				output_alphabets.push_back(&alphabet);
+			return generate_conversion_returns(output_alphabets, std::pmr::vector<bool>(alphabets.size(), false, memory_resource));
+		}
+
+        private:
+		//The digit values of the integer part in base root^power, already produced for one output base and shared with the other output bases of the same root.
+		struct SharedIntegerDigits
+		{
+			size_t                          root;
+			size_t                          power;
+			std::pmr::vector<size_t>        digit_values; //Most significant first.
+		};
+
+		//The powers of the primes of the input base in an output base, in the order of input_base_factors. Whether, and after how many digits, the part after the point ends depends only on these and the input, so they are worked out once per pair of bases.
+		struct BasePairPowers
+		{
+			size_t                          output_base;
+			std::array<size_t, 15>          output_powers;
+		};
+
+		//Whether, and after how many digits, the part after the point of the input ends in an output base, and the lengths of its prefix and repetend there. Both are asked for several times by each output, so they are worked out once per output base and kept for every later output of the same input.
+		struct FractionLengths
+		{
+			size_t                          output_base;
+			bool                            terminates; //Whether the part after the point ends in the output base.
+			size_t                          terminating_length; //The number of digits it has there, if it ends.
+			bool                            repetend_lengths_found {false}; //Whether the three below have been worked out. Only done with repetend detection.
+			bool                            repetend_within_limit {false}; //Whether the repetend is no longer than repetend_length_limit.
+			size_t                          prefix_length {0};
+			size_t                          repetend_length {0};
+		};
+
+		std::pmr::memory_resource               *memory_resource {std::pmr::get_default_resource()}; //Declared first, as the members after it are allocated from it.
+		std::pmr::vector<NarrowDigitValue>      input_narrow_digit_values {memory_resource}; //The digit values of the whole input, with the point removed, if the input alphabet has at most 256 digits.
+		std::pmr::vector<WideDigitValue>        input_wide_digit_values {memory_resource}; //The digit values of the whole input, with the point removed, for larger input alphabets.
+		bool                                    input_digit_values_narrow {true}; //Whether the digit values are in input_narrow_digit_values rather than input_wide_digit_values.
+		size_t                                  input_digit_count {0}; //The number of digit values.
+		size_t                                  input_point_position {0}; //The number of digit values before the point.
+		Integer                                 input_integer; //The integer part, once parsed.
+		NativeInteger                           input_native_integer {0}; //The integer part, once parsed, when it is known to fit in a NativeInteger.
+		boost::multiprecision::cpp_int          input_fraction_numerator; //The digits after the point as an integer, once parsed.
+		std::shared_ptr<const boost::multiprecision::cpp_int> input_fraction_denominator; //The input base to the power of the number of digits after the point, once parsed.
+		std::pmr::vector<size_t>                input_integer_bits {memory_resource}; //The integer part in 32-bit digits, most significant first, once parsed. Power-of-two output bases are sliced from it.
+		bool                                    input_integer_parsed {false};
+		bool                                    input_native_integer_parsed {false};
+		bool                                    input_integer_bits_parsed {false};
+		bool                                    input_fraction_parsed {false};
+		PrimeFactors                            input_fraction_factors; //The primes of the input base and the power of each in the denominator of the part after the point in lowest terms, once factored.
+		bool                                    input_fraction_factored {false};
+		PrimeFactors                            input_base_factors; //The primes of the input base, factored when the input alphabet is set.
+		std::pmr::vector<BasePairPowers>        base_pair_powers {memory_resource}; //The BasePairPowers of the output bases used with the input base so far.
+		std::pmr::vector<FractionLengths>       fraction_lengths {memory_resource}; //The FractionLengths of the output bases used with the input so far.
+		Alphabet			        input_alphabet {memory_resource};
+		std::string			        decimal_points {".,"};
+                bool                                    use_exceptions {false};
+		ConversionErrorSet                      input_errors;
+		ConversionWarningSet                    input_warnings;
+		Base                                    base_used;
+		wchar_t                                 input_decimal_point_used;
+		bool                                    input_is_float {false};
+		unsigned int                            precision_requested;
+		bool                                    float_precision_set {false};
+		bool                                    repetend_detection {false};
+		bool                                    repetend_notation {false};
+
+
+		//The body of try_input.
+		template <typename CharT>
+		ConversionErrorSet try_load_number(std::basic_string_view<CharT> number, const Alphabet &alphabet) noexcept
+		{
+			bool exceptions_requested = use_exceptions;
+			use_exceptions = false;
+			try
+			{
+				load_number(number, alphabet);
+			}
+			catch (const std::bad_alloc &)
+			{
+				input_errors.insert(ConversionError::allocation_failed);
+			}
+			catch (const std::length_error &) //A number too long for a vector of its digits.
+			{
+				input_errors.insert(ConversionError::allocation_failed);
+			}
+			catch (...)
+			{
+				//With exceptions turned off, only allocations are expected to throw. The number is rejected.
+				input_errors.insert(ConversionError::input_format_invalid);
+			}
+			use_exceptions = exceptions_requested;
+			return input_errors;
+		}
+
+		//Numbers are parsed in their own character type. They are only transcoded to a wstring when the alphabet has non-ASCII digits and the number's encoding may spread a character over several code units.
+		template <typename CharT>
+		void load_number(std::basic_string_view<CharT> number, const Alphabet &alphabet)
+		{
+			MemoryResourceScope memory_resource_scope(memory_resource);
+			input_errors.clear();
+			if (alphabet.is_valid())
+			{
+				//Copying an Alphabet copies its lookup tables, so it is skipped when the digits are the same as last time.
+				if (input_alphabet.get_digits() != alphabet.get_digits() || input_alphabet.does_allow_uppercase() != alphabet.does_allow_uppercase())
+				{
+					if (input_alphabet.get_base() != alphabet.get_base())
+					{
+						input_base_factors = factorize(alphabet.get_base());
+						base_pair_powers.clear();
+					}
+					input_alphabet = alphabet;
+				}
+				if constexpr (!std::is_same<CharT, wchar_t>::value)
+				{
+					if (!alphabet.is_ascii() && (std::is_same<CharT, char>::value || sizeof(CharT) > sizeof(wchar_t)))
+					{
+						std::wstring number_w;
+						if constexpr (std::is_same<CharT, char>::value)
+							number_w = convert_string_to_wstring(number);
+						else
+							number_w = convert_u32string_to_wstring(number);
+						parse_input(std::wstring_view(number_w));
+						return;
+					}
+				}
+				parse_input(number);
+			}
+			else
+                                set_error(ConversionError::input_digits_repeated);
+		}
+
+		//Validates the characters of the input, finds its point and decodes its digit values, all in a single pass. The digit values are held in the narrowest type which fits the input alphabet.
+		template <typename CharT>
+		void parse_input(std::basic_string_view<CharT> number)
+		{
+			input_is_float = false;
+			input_integer_parsed = false;
+			input_native_integer_parsed = false;
+			input_integer_bits_parsed = false;
+			input_fraction_parsed = false;
+			input_fraction_factored = false;
+			fraction_lengths.clear();
+			input_digit_values_narrow = input_alphabet.get_base() <= 256;
+			bool illegal_character_found = input_digit_values_narrow ? !decode_digit_values(number, input_narrow_digit_values) : !decode_digit_values(number, input_wide_digit_values);
+			if (!input_is_float)
+				input_point_position = input_digit_count;
+			if (illegal_character_found)
+				set_error(ConversionError::input_format_invalid);
+			else if (!does_input_integer_fit())
+				set_error(ConversionError::input_too_large);
+			if (input_is_float)
+				set_default_float_precision();
+		}
+
+		//The loop of parse_input, which decodes the digit values into digit_values and finds the point. Returns false at the first character which is neither a digit nor the point.
+		template <typename CharT, typename DigitValue>
+		bool decode_digit_values(std::basic_string_view<CharT> number, std::pmr::vector<DigitValue> &digit_values)
+		{
+			bool illegal_character_found {false};
+			digit_values.clear();
+			digit_values.reserve(number.length());
+			for (size_t num {0}; !illegal_character_found && num < number.length(); num++)
+			{
+				std::uint32_t code = static_cast<typename std::make_unsigned<CharT>::type>(number[num]);
+				size_t digit_value = std::wstring::npos;
+				if (code <= std::numeric_limits<std::make_unsigned<wchar_t>::type>::max())
+					digit_value = input_alphabet.get_digit_value(static_cast<wchar_t>(code));
+				if (digit_value != std::wstring::npos)
+					digit_values.push_back(static_cast<DigitValue>(digit_value));
+				else if (!input_is_float && num != 0 && is_decimal_point(code))
+				{
+					input_decimal_point_used = static_cast<wchar_t>(code);
+					input_point_position = digit_values.size();
+					input_is_float = true;
+				}
+				else
+					illegal_character_found = true;
+			}
+			input_digit_count = digit_values.size();
+			return !illegal_character_found;
+		}
+
+		//Calls function with the digit values of the input, in whichever of input_narrow_digit_values and input_wide_digit_values holds them, and returns its result.
+		template <typename Function>
+		auto visit_input_digit_values(Function function)
+		{
+			if (input_digit_values_narrow)
+				return function(input_narrow_digit_values);
+			return function(input_wide_digit_values);
+		}
+
+		bool is_decimal_point(std::uint32_t character)
+		{
+			return character < 128 && decimal_points.find(static_cast<char>(character)) != std::string::npos;
+		}
+
+		void set_default_float_precision()
 		{
-			input(number_s, digits, throw_exception);
+		        if (!float_precision_set)
+                        {
+                                precision_requested = float_precision_default;
+                                float_precision_set = true;
+                        }
 		}
 
-                //Construct with a std::string encoded number, and an AnyBaseConversion defined Base.
-		BaseConversion(std::string &number_s, Base base, bool throw_exception = false)
+		//The index of the first non-zero digit of the integer part, or the point if there is none.
+		size_t get_input_integer_start()
 		{
-			std::wstring number_w = convert_string_to_wstring(number_s);
-			input(number_w, base, throw_exception);
-		}
+			return visit_input_digit_values([this](const auto &digit_values)
+			{
+				size_t start {0};
+				while (start < input_point_position && digit_values[start] == 0)
+					start++;
+				return start;
+			});
+		}
 
-                //Construct with a std::string encoded number and a user-defined std::string definition of the numbering.
-		BaseConversion(std::string &number_s, std::string &digits, bool throw_exception = false)
+		//Whether the integer part of the input fits in Integer. Only bounded types can fail. The number of digits settles most inputs, and only those near the limit are parsed to check.
+		bool does_input_integer_fit()
 		{
-			std::wstring number_w = convert_string_to_wstring(number_s);
-			std::wstring digits_w = convert_string_to_wstring(digits);
-			input(number_w, digits_w, throw_exception);
+			if constexpr (!std::numeric_limits<Integer>::is_bounded)
+				return true;
+			else
+			{
+				size_t length = input_point_position - get_input_integer_start();
+				if (length == 0)
+					return true;
+				size_t base = input_alphabet.get_base();
+				double bits_per_digit = std::log2(static_cast<double>(base));
+				double integer_bits = static_cast<double>(std::numeric_limits<Integer>::digits);
+				if (static_cast<double>(length) * bits_per_digit <= integer_bits - 1)
+					return true;
+				if (static_cast<double>(length - 1) * bits_per_digit >= integer_bits + 1)
+					return false;
+				size_t start = get_input_integer_start();
+				boost::multiprecision::cpp_int value = visit_input_digit_values([&](const auto &digit_values) { return convert_digit_values_to_integer(digit_values, start, input_point_position, base); });
+				return boost::multiprecision::msb(value) < static_cast<size_t>(std::numeric_limits<Integer>::digits);
+			}
 		}
-
-                //Construct an empty object.
-		BaseConversion()
+
+		//The number of digits after the point.
+		size_t get_input_fraction_length()
 		{
-			//No action.
+			return input_digit_count - input_point_position;
 		}
-
-                //Input a std::wstring number and an AnyBaseConversion::Base to an empty BaseConversion, or overwrite the existing user input if not empty.
-		void input(std::wstring &number_w, Base base, bool throw_exception = false)
+
+		//The integer part of the input. Parsed on first use and kept for every later output of the same input.
+		const Integer &get_input_integer()
 		{
-			if (throw_exception)
-				throw_exception = true;
-                        std::wstring digits = convert_base_to_char_set(base);
-			defined_input_digits = true;
-			if (does_base_allow_use_uppercase(base))
+			if (!input_integer_parsed)
 			{
-				std::wstring number_in_lower_case = number_w;
-				std::transform(number_in_lower_case.begin(), number_in_lower_case.end(), number_in_lower_case.begin(), ::tolower);
-				load_number(number_in_lower_case, digits);
+				size_t start = get_input_integer_start();
+				input_integer = visit_input_digit_values([&](const auto &digit_values) { return convert_digit_values_to_integer<Integer>(digit_values, start, input_point_position, input_alphabet.get_base()); });
+				input_integer_parsed = true;
 			}
-			else
-				load_number(number_w, digits);
+			return input_integer;
 		}
 
-		//Input a std::wstring number and a user-defined std::wstring numbering definition to an empty BaseConversion, or overwrite the existing user input if not empty.
-		void input(std::wstring &number_w, std::wstring &digits_w, bool throw_exception = false)
+		//Whether the integer part of the input has few enough digits that it always fits in a NativeInteger, so that it can be converted without big integers.
+		bool is_input_integer_native()
 		{
-			if (throw_exception)
-				use_exceptions = true;
-                        load_number(number_w, digits_w);
+			return input_point_position - get_input_integer_start() <= input_alphabet.get_native_digits();
 		}
-
-                //Input a std::string number and an AnyBaseConversion::Base to an empty BaseConversion, or overwrite the existing user input if not empty.
-                void input(std::string &number_s, Base base, bool throw_exception = false)
-                {
-                        std::wstring number_w = convert_string_to_wstring(number_s);
-			input(number_w, base, throw_exception);
-                }
-
-                //Input a std::string number and a user-defined std::string numbering definition to an empty BaseConversion, or overwrite the existing user input if not empty.
-		void input(std::string &number_s, std::string &digits, bool throw_exception = false)
-		{
-		        std::wstring number_w = convert_string_to_wstring(number_s);
-			std::wstring digits_w = convert_string_to_wstring(digits);
-			input(number_w, digits_w, throw_exception);
-		}
-
-		//Set the precision (maximum number of digits after the decimal point) of the output float (if it is a float).
-		void set_float_precision(int precision_given)
-		{
-			if (precision_given < 1)
-                                set_warning("Warning: Illegal float precision. Try again with a float precision of at least 1.");
-			precision_requested = precision_given;
-                        float_precision_set = true;
-		}
-
-                //Output the number as a string in a defined base. If an error occurs, will output an empty string: "".
-                //Allows some defined bases (e.g. hexadecimal) to convert digits which are letters to uppercase. Only available for those bases which already use lowercase letters but no uppercase letters as digits.
-		std::string output_string(Base base, bool use_uppercase = false)
+
+		//The integer part of the input as a NativeInteger. Only for inputs where is_input_integer_native(). Parsed on first use and kept for every later output of the same input.
+		NativeInteger get_input_native_integer()
 		{
-			ConversionReturn conversion_return = generate_conversion_return(base, use_uppercase);
-			return convert_wstring_to_string(conversion_return.output);
+			if (!input_native_integer_parsed)
+			{
+				size_t start = get_input_integer_start();
+				input_native_integer = visit_input_digit_values([&](const auto &digit_values) { return convert_digit_values_to_native_integer(digit_values, start, input_point_position, input_alphabet); });
+				input_native_integer_parsed = true;
+			}
+			return input_native_integer;
 		}
-
-		//Output the number as a string in a user-defined base. If an error occurs, will output an empty string: "".
-		std::string output_string(std::string digits)
-		{
-                        std::wstring digits_w = convert_string_to_wstring(digits);
-                        ConversionReturn conversion_return = generate_conversion_return(digits_w);
-                        return convert_wstring_to_string(conversion_return.output);
-		}
-
-		//Output the number as a wstring in a defined base. If an error occurs, will output an empty string: "".
-		std::wstring output_wstring(Base base, bool use_uppercase = false)
-		{
-			ConversionReturn conversion_return = generate_conversion_return(base, use_uppercase);
-			return conversion_return.output;
-		}
-
-                //Output the number as a wstring in a user-defined base. If an error occurs, will output an empty string: "".
-		std::wstring output_wstring(std::wstring digits_w)
-		{
-                        ConversionReturn conversion_return = generate_conversion_return(digits_w);
-                        return conversion_return.output;
-		}
-
-		//It is recommended that you always get the return as a ConversionReturn. This will allow you to know if any errors or warnings occurred.
-
-		//Output the number as a ConversionReturn in a defined base.
-		AnyBaseConversion::ConversionReturn output_conversion_return(Base base, bool use_uppercase = false)
-		{
-		        ConversionReturn conversion_return = generate_conversion_return(base, use_uppercase);
-		        return conversion_return;
-		}
-
-                //Output the number as a ConversionReturn in a user-defined wstring base.
-		AnyBaseConversion::ConversionReturn output_conversion_return(std::wstring digits_w)
-		{
-		        ConversionReturn conversion_return = generate_conversion_return(digits_w);
-		        return conversion_return;
-		}
-
-                //Output the number as a ConversionReturn in a user-defined string base.
-		AnyBaseConversion::ConversionReturn output_conversion_return(std::string digits)
-		{
-		        ConversionReturn conversion_return = generate_conversion_return(convert_string_to_wstring(digits));
-		        return conversion_return;
-		}
-
-        private:
-		std::wstring			        input_front;
-		std::wstring			        input_back;
-		std::wstring			        input_digits;
-		std::string			        decimal_points {".,"};
-                bool                                    use_exceptions {false};
-                bool                                    input_errors_encountered {false};
-		bool                                    input_warnings_encountered {false};
-		std::vector<std::string>                input_errors;
-		std::vector<std::string>                input_warnings;
-		bool                                    defined_input_digits {false};
-		Base                                    base_used;
-		wchar_t                                 input_decimal_point_used;
-		bool                                    input_is_float {false};
-		unsigned int                            precision_requested;
-		bool                                    float_precision_set {false};
-
 
-		void load_number(std::wstring &number_s, std::wstring char_set)
+		//The integer part of the input in 32-bit digits, so that it can be bit sliced into any power-of-two base. Kept for every later output of the same input.
+		const std::pmr::vector<size_t> &get_input_integer_bits()
 		{
-			ValidationReturn validation_return = validate_digits(char_set);
-			if (defined_input_digits || validation_return.valid)
+			if (!input_integer_bits_parsed)
 			{
-				input_front = number_s;
-				input_digits = char_set;
-				validate_input();
-				break_into_float();
-			}
-			else if (!validation_return.valid)
-                                set_errors(validation_return.error_messages);
+				input_integer_bits.clear();
+				export_integer_bits(get_input_integer(), input_integer_bits);
+				input_integer_bits_parsed = true;
+			}
+			return input_integer_bits;
 		}
 
-
-		ValidationReturn validate_digits(std::wstring digits) //For this function and the next one, need to return a bool and a string, with the error if there is one. Maybe return a vector of errors, all of which can be copied.
+		//The part of the input after the point, as the exact fraction input_fraction_numerator / input_fraction_denominator. Parsed on first use and kept for every later output of the same input.
+		void parse_input_fraction()
 		{
-			bool repeat_digit_found {false};
-			size_t i {0};
-			while (!repeat_digit_found && i < digits.length())
+			if (!input_fraction_parsed)
 			{
-				wchar_t digit_character = digits[i];
-				if (count_instances_of_wchar_t_in_wstring(digit_character, digits) > 1)
-					repeat_digit_found = true;
-				i++;
-			}
-			ValidationReturn validation_return;
-			if (repeat_digit_found)
-                        {
-                                validation_return.valid = false;
-                                validation_return.error_messages.push_back("The inputted set of digits contains repeat characters. To be used for base conversion, every character must be unique.");
-                        }
-                        else
-                                validation_return.valid = true;
-                        return validation_return;
+				size_t base = input_alphabet.get_base();
+				input_fraction_numerator = visit_input_digit_values([&](const auto &digit_values) { return convert_digit_values_to_integer(digit_values, input_point_position, input_digit_count, base); });
+				input_fraction_denominator = PowerCache::instance().get_power(base, get_input_fraction_length());
+				input_fraction_parsed = true;
+			}
 		}
 
-		void validate_input()
+		//Factors the denominator of the part after the point in lowest terms. It is a power of the input base, so its primes are those of the input base, each losing the powers of it which divide the numerator.
+		//Each trailing zero digit cancels a whole input base, so only the numerator without them is tried. Factored on first use and kept for every later output of the same input.
+		void factor_input_fraction()
 		{
-			bool illegal_character_found {false};
-			bool decimal_point_found {false};
-			size_t num {0};
-			std::string test = convert_wstring_to_string(input_front);
-			while (!illegal_character_found && num < input_front.length())
+			if (!input_fraction_factored)
 			{
-				wchar_t wct = static_cast<char>(input_front[num]);
-				if (count_instances_of_wchar_t_in_wstring(wct, input_digits) != 1)
+				size_t trailing_zeroes = get_input_fraction_trailing_zeroes();
+				size_t significant_length = get_input_fraction_length() - trailing_zeroes;
+				boost::multiprecision::cpp_int numerator;
+				if (significant_length != 0)
 				{
-					std::wstring decimal_points_w = convert_string_to_wstring(decimal_points);
-					if (count_instances_of_wchar_t_in_wstring(wct, decimal_points_w) == 1)
+					if (trailing_zeroes == 0)
 					{
-						if (!decimal_point_found && num != 0 && num != input_front.size())
-						{
-							input_decimal_point_used = input_front[num];
-							decimal_point_found = true;
-							input_is_float = true;
-						}
-						else
-							illegal_character_found = true;
+						parse_input_fraction();
+						numerator = input_fraction_numerator;
 					}
 					else
-						illegal_character_found = true;
+						numerator = visit_input_digit_values([&](const auto &digit_values) { return convert_digit_values_to_integer(digit_values, input_point_position, input_point_position + significant_length, input_alphabet.get_base()); });
+				}
+				input_fraction_factors = input_base_factors;
+				for (size_t i { 0 }; i < input_fraction_factors.count; i++)
+				{
+					size_t power = input_fraction_factors.powers[i] * significant_length;
+					if (power != 0)
+						power -= cancel_prime(numerator, input_fraction_factors.primes[i], power);
+					input_fraction_factors.powers[i] = power;
 				}
-				num++;
+				input_fraction_factored = true;
 			}
-			if (illegal_character_found)
-				set_error("Input string does not match formatting requirements. It may have illegal characters, or it may have more than one decimal point or a decimal point in the wrong place.");
 		}
 
-		void set_default_float_precision()
-		{
-		        if (!float_precision_set)
-                        {
-                                precision_requested = float_precision_default;
-                                float_precision_set = true;
-                        }
-		}
-
-		void break_into_float()
+		//The number of zero digits at the end of the part after the point.
+		size_t get_input_fraction_trailing_zeroes()
 		{
-			if (input_is_float)
+			return visit_input_digit_values([&](const auto &digit_values)
+			{
+				size_t end { input_digit_count };
+				while (end > input_point_position && digit_values[end - 1] == 0)
+					end--;
+				return input_digit_count - end;
+			});
+		}
+
+		//Divides num by the largest power of prime, up to prime^limit, which divides it, and returns that power.
+		//The squares prime^(2^k) from the PowerCache are divided out while they go in, and then the smaller ones are tried from the largest down, so a power of n takes about 2 log2(n) divisions.
+		static size_t cancel_prime(boost::multiprecision::cpp_int &num, std::uint64_t prime, size_t limit)
+		{
+			if (num == 0 || num % prime != 0)
+				return 0;
+			size_t cancelled { 0 };
+			size_t k { 0 };
+			boost::multiprecision::cpp_int quotient;
+			boost::multiprecision::cpp_int remainder;
+			for (; (static_cast<size_t>(1) << k) <= limit - cancelled; k++)
+			{
+				boost::multiprecision::divide_qr(num, *PowerCache::instance().get_squared_power(prime, k), quotient, remainder);
+				if (remainder != 0)
+					break;
+				num.swap(quotient);
+				cancelled += static_cast<size_t>(1) << k;
+			}
+			while (k > 0)
+			{
+				k--;
+				if ((static_cast<size_t>(1) << k) > limit - cancelled)
+					continue;
+				boost::multiprecision::divide_qr(num, *PowerCache::instance().get_squared_power(prime, k), quotient, remainder);
+				if (remainder != 0)
+					continue;
+				num.swap(quotient);
+				cancelled += static_cast<size_t>(1) << k;
+			}
+			return cancelled;
+		}
+
+		//The BasePairPowers of an output base with the input base. Worked out on first use and kept until the input base changes.
+		const BasePairPowers &get_base_pair_powers(size_t output_base)
+		{
+			for (const BasePairPowers &powers : base_pair_powers)
+				if (powers.output_base == output_base)
+					return powers;
+			PrimeFactors output_factors = factorize(output_base);
+			BasePairPowers powers { output_base, {} };
+			for (size_t i { 0 }; i < input_base_factors.count; i++)
+				powers.output_powers[i] = output_factors.get_power(input_base_factors.primes[i]);
+			base_pair_powers.push_back(powers);
+			return base_pair_powers.back();
+		}
+
+		//The FractionLengths of an output base with the input, with the terminating length worked out. Found on first use and kept until the next input.
+		//The part after the point ends if every prime of its denominator in lowest terms divides the output base, and a prime with a power of p in the denominator and of q in the output base needs p / q digits, rounded up.
+		FractionLengths &get_fraction_lengths(size_t output_base)
+		{
+			for (FractionLengths &lengths : fraction_lengths)
+				if (lengths.output_base == output_base)
+					return lengths;
+			factor_input_fraction();
+			const BasePairPowers &powers = get_base_pair_powers(output_base);
+			FractionLengths lengths { output_base, true, 0 };
+			for (size_t i { 0 }; i < input_fraction_factors.count; i++)
+			{
+				size_t power = input_fraction_factors.powers[i];
+				size_t output_power = powers.output_powers[i];
+				if (power == 0)
+					continue;
+				if (output_power == 0)
+				{
+					lengths.terminates = false;
+					lengths.terminating_length = 0;
+					break;
+				}
+				lengths.terminating_length = std::max(lengths.terminating_length, (power + output_power - 1) / output_power);
+			}
+			fraction_lengths.push_back(lengths);
+			return fraction_lengths.back();
+		}
+
+		//Whether the part after the point of the input ends in an output base, and if so the number of digits it has there, found without generating any.
+		bool get_terminating_length(size_t output_base, size_t &length)
+		{
+			const FractionLengths &lengths = get_fraction_lengths(output_base);
+			length = lengths.terminating_length;
+			return lengths.terminates;
+		}
+
+		//Finds the number of digits after the point before the repetend, and the length of the repetend, of the input in an output base. Returns false if the repetend is longer than repetend_length_limit.
+		//The primes of the denominator in lowest terms which the output base shares end within a number of digits, and the prefix is the most of those, as in get_terminating_length. Each other prime gives a repetend of the order of the output base
+		//modulo its power, and the repetend of the whole is the least common multiple of those.
+		//Worked out on first use and kept in the FractionLengths of the output base.
+		bool get_repetend_lengths(size_t output_base, size_t &prefix_length, size_t &repetend_length)
+		{
+			FractionLengths &lengths = get_fraction_lengths(output_base);
+			if (!lengths.repetend_lengths_found)
+			{
+				lengths.repetend_within_limit = find_repetend_lengths(output_base, lengths.prefix_length, lengths.repetend_length);
+				lengths.repetend_lengths_found = true;
+			}
+			prefix_length = lengths.prefix_length;
+			repetend_length = lengths.repetend_length;
+			return lengths.repetend_within_limit;
+		}
+
+		//The body of get_repetend_lengths.
+		bool find_repetend_lengths(size_t output_base, size_t &prefix_length, size_t &repetend_length)
+		{
+			const BasePairPowers &powers = get_base_pair_powers(output_base);
+			prefix_length = 0;
+			repetend_length = 0;
+			for (size_t i { 0 }; i < input_fraction_factors.count; i++)
+			{
+				std::uint64_t prime = input_fraction_factors.primes[i];
+				size_t power = input_fraction_factors.powers[i];
+				size_t output_power = powers.output_powers[i];
+				if (power == 0)
+					continue;
+				if (output_power != 0)
+					prefix_length = std::max(prefix_length, (power + output_power - 1) / output_power);
+				else
+				{
+					std::uint64_t order = get_multiplicative_order(output_base, prime, power, repetend_length_limit);
+					if (order == 0)
+						return false;
+					repetend_length = repetend_length == 0 ? order : std::lcm(repetend_length, order);
+					if (repetend_length > repetend_length_limit)
+						return false;
+				}
+			}
+			return true;
+		}
+
+		//Sets the prefix and repetend of conversion_return to the exact digits after the point, the prefix followed by one period of the repetend. Warns and returns false if the repetend is too long.
+		bool find_repetend(ConversionReturn &conversion_return, const Alphabet &output_alphabet)
+		{
+			size_t prefix_length;
+			size_t repetend_length;
+			if (!get_repetend_lengths(conversion_return.output_base, prefix_length, repetend_length))
 			{
-				set_default_float_precision();
-				size_t decimal_point_location = input_front.find_first_of(input_decimal_point_used);
-				input_back = input_front.substr((decimal_point_location + 1), std::wstring::npos);
-				input_front = input_front.substr(0, (decimal_point_location));
+				set_warning(ConversionWarning::repetend_too_long, conversion_return);
+				return false;
 			}
+			BasicOutputBuffer<wchar_t> digits(memory_resource);
+			digits.reset(0, prefix_length + repetend_length);
+			calculate_raw_output(prefix_length + repetend_length, output_alphabet, digits);
+			conversion_return.prefix = digits.view().substr(0, prefix_length);
+			conversion_return.repetend = digits.view().substr(prefix_length);
+			conversion_return.repetend_found = true;
+			return true;
 		}
 
 		ConversionReturn generate_conversion_return(Base base, bool use_uppercase = false)
 		{
 			if (!does_base_allow_use_uppercase(base))
 				use_uppercase = false;
-			return generate_conversion_return(convert_base_to_char_set(base), use_uppercase, true);
+			return generate_conversion_return(get_alphabet_from_base(base), use_uppercase, true);
 		}
 
-		ConversionReturn generate_conversion_return(std::wstring output_digits, bool use_uppercase = false, bool defined_base_requested = false)
+		ConversionReturn generate_conversion_return(const Alphabet &output_alphabet, bool use_uppercase = false, bool defined_base_requested = false)
 		{
-		        ConversionReturn conversion_return {};
+		        MemoryResourceScope memory_resource_scope(memory_resource);
+		        ConversionReturn conversion_return(memory_resource);
+		        OutputBuffer output_buffer(memory_resource);
+		        convert_into_buffer(conversion_return, output_alphabet, defined_base_requested && use_uppercase, output_buffer);
+                        set_output(conversion_return, output_buffer);
+                        return conversion_return;
+		}
+
+		//The body of output_many. Bases are converted largest first, so that the digits of the largest base of each root can be shared with the smaller ones.
+		std::pmr::vector<ConversionReturn> generate_conversion_returns(const std::pmr::vector<const Alphabet *> &output_alphabets, const std::pmr::vector<bool> &uppercase_used)
+		{
+			MemoryResourceScope memory_resource_scope(memory_resource);
+			std::pmr::vector<ConversionReturn> conversion_returns(output_alphabets.size(), memory_resource);
+			std::pmr::vector<size_t> order(output_alphabets.size(), memory_resource);
+			for (size_t i { 0 }; i < order.size(); i++)
+				order[i] = i;
+			//Ties keep their order. std::sort is used with the index as a tie-break, as std::stable_sort takes its buffer from new rather than from the memory resource.
+			std::sort(order.begin(), order.end(), [&output_alphabets](size_t a, size_t b) { return output_alphabets[a]->get_base() > output_alphabets[b]->get_base() || (output_alphabets[a]->get_base() == output_alphabets[b]->get_base() && a < b); });
+			std::pmr::vector<SharedIntegerDigits> shared_integer_digits(memory_resource);
+			for (size_t i : order)
+			{
+				const Alphabet &output_alphabet = *output_alphabets[i];
+				size_t power;
+				size_t root = get_smallest_root_of_base(output_alphabet.get_base(), power);
+				const SharedIntegerDigits *shared = nullptr;
+				for (const SharedIntegerDigits &candidate : shared_integer_digits)
+					if (candidate.root == root)
+						shared = &candidate;
+				ConversionReturn &conversion_return = conversion_returns[i];
+				OutputBuffer output_buffer(memory_resource);
+				convert_into_buffer(conversion_return, output_alphabet, uppercase_used[i], output_buffer, shared);
+				set_output(conversion_return, output_buffer);
+				//Keep the digits for later bases of the same root, unless they are cheap to produce anyway (power-of-two bases, or a root shared with the input).
+				if (shared == nullptr && root > 2 && !conversion_return.errors_encountered && !do_bases_share_a_common_root(conversion_return) && !is_input_integer_native())
+				{
+					SharedIntegerDigits digits { root, power, std::pmr::vector<size_t>(memory_resource) };
+					digits.digit_values.reserve(conversion_return.before_point.size());
+					for (wchar_t digit : conversion_return.before_point)
+						digits.digit_values.push_back(output_alphabet.get_digit_value(digit));
+					shared_integer_digits.push_back(std::move(digits));
+				}
+			}
+			return conversion_returns;
+		}
+
+		//The std::string equivalent of generate_conversion_return, returning only the output. ASCII alphabets are converted in a char OutputBuffer, whose characters are copied once into the string returned, so no wstring is built.
+		std::string generate_string(const Alphabet &output_alphabet, bool use_uppercase = false, bool defined_base_requested = false)
+		{
+		        if (!output_alphabet.is_ascii())
+                                return convert_wstring_to_string(generate_conversion_return(output_alphabet, use_uppercase, defined_base_requested).output);
+		        MemoryResourceScope memory_resource_scope(memory_resource);
+		        ConversionReturn conversion_return(memory_resource);
+		        BasicOutputBuffer<char> output_buffer(memory_resource);
+		        convert_into_buffer(conversion_return, output_alphabet, defined_base_requested && use_uppercase, output_buffer);
+                        if (conversion_return.errors_encountered)
+                                return std::string {};
+                        std::string output = output_buffer.str();
+                        if (conversion_return.is_float && !output_buffer.has_point())
+                                output += static_cast<char>(conversion_return.decimal_point_used);
+                        return output;
+		}
+
+		//The body of convert_into. Works in a BasicOutputBuffer over the caller's storage, split at the integer estimate, then moves the output to the start of the storage.
+		template <typename CharT>
+		ConvertIntoReturn convert_into_storage(CharT *out, size_t out_size, const Alphabet &output_alphabet, bool use_uppercase)
+		{
+			if (!input_errors.empty())
+				return ConvertIntoReturn {0, ConversionStatus::invalid_input};
+			if (!output_alphabet.is_valid())
+				return ConvertIntoReturn {0, ConversionStatus::invalid_output_alphabet};
+			if (std::is_same<CharT, char>::value && !output_alphabet.is_ascii())
+				return ConvertIntoReturn {0, ConversionStatus::output_alphabet_not_ascii};
+			MemoryResourceScope memory_resource_scope(memory_resource);
+			ConversionReturn conversion_return = get_conversion_info(output_alphabet);
+			size_t integer_length = estimate_integer_length(conversion_return);
+			if (out_size < integer_length + estimate_fraction_length(conversion_return))
+				return ConvertIntoReturn {0, ConversionStatus::output_too_small};
+			BasicOutputBuffer<CharT> output_buffer(out, out_size, integer_length);
+			convert_front(conversion_return, output_alphabet, output_buffer);
+			convert_back(conversion_return, output_alphabet, output_buffer);
+			if (use_uppercase)
+				convert_output_digits_to_uppercase(output_buffer);
+			if (output_buffer.overflowed())
+				return ConvertIntoReturn {0, ConversionStatus::output_too_small};
+			if (conversion_return.is_float && !output_buffer.has_point())
+				output_buffer.push_back(static_cast<CharT>(conversion_return.decimal_point_used));
+			return ConvertIntoReturn {output_buffer.move_to_start(), ConversionStatus::success};
+		}
+
+		//A ConversionReturn holding only what the conversion itself reads: the bases, whether the input is a float, and the precision. Copies no strings.
+		ConversionReturn get_conversion_info(const Alphabet &output_alphabet)
+		{
+			ConversionReturn conversion_return(memory_resource);
+			conversion_return.is_float = input_is_float;
+			if (conversion_return.is_float)
+				conversion_return.decimal_point_used = input_decimal_point_used;
+			conversion_return.input_base = input_alphabet.get_base();
+			conversion_return.output_base = output_alphabet.get_base();
+			conversion_return.precision = precision_requested;
+			return conversion_return;
+		}
+
+		template <typename CharT>
+		void convert_into_buffer(ConversionReturn &conversion_return, const Alphabet &output_alphabet, bool use_uppercase, BasicOutputBuffer<CharT> &output_buffer, const SharedIntegerDigits *shared_integer_digits = nullptr)
+		{
 		        populate_conversion_return (conversion_return);
-		        ValidationReturn validation_return = validate_digits(output_digits);
-		        if (validation_return.valid)
+		        if (output_alphabet.is_valid())
 		        {
-		                set_output_info(conversion_return, output_digits);
-                                convert_front(conversion_return);
+		                set_output_info(conversion_return, output_alphabet.get_digits());
+                                convert_front(conversion_return, output_alphabet, output_buffer, shared_integer_digits);
                                 if (conversion_return.is_float)
-                                                convert_back(conversion_return);
-                                if (defined_base_requested && use_uppercase)
-                                        convert_output_digits_to_uppercase(conversion_return);
+                                                convert_back(conversion_return, output_alphabet, output_buffer);
+                                if (use_uppercase)
+                                {
+                                        convert_output_digits_to_uppercase(output_buffer);
+                                        std::transform(conversion_return.prefix.begin(), conversion_return.prefix.end(), conversion_return.prefix.begin(), ::toupper);
+                                        std::transform(conversion_return.repetend.begin(), conversion_return.repetend.end(), conversion_return.repetend.begin(), ::toupper);
+                                }
 		        }
 		        else
-                                set_errors(validation_return.error_messages);
-                        set_output(conversion_return);
-                        return conversion_return;
+                                set_error(ConversionError::output_digits_repeated, conversion_return);
 		}
 
 		void populate_conversion_return(ConversionReturn &conversion_return)
 		{
-		        conversion_return.errors_encountered = input_errors_encountered;
-		        conversion_return.warnings_encountered = input_warnings_encountered;
+		        conversion_return.errors_encountered = !input_errors.empty();
+		        conversion_return.warnings_encountered = !input_warnings.empty();
 		        conversion_return.errors = input_errors;
 		        conversion_return.warnings = input_warnings;
 		        conversion_return.is_float = input_is_float;
 		        if (conversion_return.is_float)
                                 conversion_return.decimal_point_used = input_decimal_point_used;
-                        conversion_return.input_base = input_digits.size();
-                        conversion_return.input_digits = input_digits;
+                        conversion_return.input_base = input_alphabet.get_base();
+                        conversion_return.input_digits = input_alphabet.get_digits();
                         conversion_return.precision = precision_requested;
 		}
 
-		void set_output(ConversionReturn &conversion_return)
+		//Takes the finished strings from the OutputBuffer, the only point at which the output is copied.
+		void set_output(ConversionReturn &conversion_return, const OutputBuffer &output_buffer)
 		{
+                        conversion_return.before_point = output_buffer.get_before_point();
+                        conversion_return.after_point = output_buffer.get_after_point();
                         if (!conversion_return.errors_encountered)
                         {
-                                conversion_return.output = conversion_return.before_point;
-                                if (conversion_return.is_float)
-                                        conversion_return.output += conversion_return.decimal_point_used + conversion_return.after_point;
+                                conversion_return.output = output_buffer.view();
+                                if (conversion_return.is_float && !output_buffer.has_point())
+                                        conversion_return.output += conversion_return.decimal_point_used;
                         }
                         else
-                        {
-                                std::string empty_string {""};
-                                conversion_return.output = convert_string_to_wstring(empty_string);
-                        }
+                                conversion_return.output.clear();
 		}
 
-		void set_output_info(ConversionReturn &conversion_return, std::wstring &output_digits)
+		void set_output_info(ConversionReturn &conversion_return, std::wstring_view output_digits)
 		{
 		        if (!conversion_return.errors_encountered)
                         {
@@ -549,224 +2791,577 @@ namespace AnyBaseConversion
                         }
 		}
 
-		void convert_front(ConversionReturn &conversion_return)
+		template <typename CharT>
+		void convert_front(ConversionReturn &conversion_return, const Alphabet &output_alphabet, BasicOutputBuffer<CharT> &output_buffer, const SharedIntegerDigits *shared_integer_digits = nullptr)
 		{
 			if (!conversion_return.errors_encountered)
-                                convert_base_front(conversion_return);
+                                convert_base_front(conversion_return, output_alphabet, output_buffer, shared_integer_digits);
 		}
 
-		void convert_back(ConversionReturn & conversion_return)
+		template <typename CharT>
+		void convert_back(ConversionReturn & conversion_return, const Alphabet &output_alphabet, BasicOutputBuffer<CharT> &output_buffer)
 		{
 			if (conversion_return.is_float && !conversion_return.errors_encountered)
-                                convert_base_back(conversion_return);
+                                convert_base_back(conversion_return, output_alphabet, output_buffer);
 		}
 
-		void trim_zeroes_from_integer(ConversionReturn &conversion_return)
+		template <typename CharT>
+		void trim_zeroes_from_integer(const Alphabet &output_alphabet, BasicOutputBuffer<CharT> &output_buffer)
 		{
-		        wchar_t zero_char = conversion_return.output_digits[0];
-		        if (conversion_return.before_point.size() > 1)
+		        wchar_t zero_char = output_alphabet.get_digit(0);
+		        if (output_buffer.size() > 1)
                         {
-                                bool only_zeroes_encountered = true;
-                                while (only_zeroes_encountered)
-                                {
-                                        if (conversion_return.before_point[0] == zero_char)
-                                                conversion_return.before_point = conversion_return.before_point.substr(1, std::wstring::npos);
-                                        else
-                                                only_zeroes_encountered = false;
-                                }
+                                while (!output_buffer.empty() && output_buffer.front() == zero_char)
+                                        output_buffer.pop_front();
                         }
-                        if (conversion_return.before_point.size() == 0)
-                                conversion_return.before_point += zero_char;
+                        if (output_buffer.empty())
+                                output_buffer.push_front(zero_char);
 		}
 
-                void convert_base_front(ConversionReturn &conversion_return)
+                //Whether both the input and output bases are powers of two, so the conversion can be done by bit slicing.
+                bool is_bit_slicing_possible(ConversionReturn &conversion_return)
+                {
+                        return get_bits_per_digit(conversion_return.input_base) != 0 && get_bits_per_digit(conversion_return.output_base) != 0;
+                }
+
+                //Whether the input and output bases are both powers of a common root (e.g. 3 and 9, 2 and 8, 5 and 25), so the conversion can be done by regrouping digits. Includes bases of the same size.
+                bool do_bases_share_a_common_root(ConversionReturn &conversion_return)
+                {
+                        size_t input_power;
+                        size_t output_power;
+                        size_t input_root = get_smallest_root_of_base(conversion_return.input_base, input_power);
+                        return input_root != 0 && input_root == get_smallest_root_of_base(conversion_return.output_base, output_power);
+                }
+
+                //Room to reserve for the integer part: exact for bit slicing and regrouping, and from the ratio of the logarithms of the bases otherwise, with one spare character.
+                size_t estimate_integer_length(ConversionReturn &conversion_return)
+                {
+                        if (is_bit_slicing_possible(conversion_return))
+                        {
+                                size_t input_bits = get_bits_per_digit(conversion_return.input_base);
+                                size_t output_bits = get_bits_per_digit(conversion_return.output_base);
+                                return (input_point_position * input_bits + output_bits - 1) / output_bits + 1;
+                        }
+                        if (do_bases_share_a_common_root(conversion_return))
+                        {
+                                size_t input_power;
+                                size_t output_power;
+                                get_smallest_root_of_base(conversion_return.input_base, input_power);
+                                get_smallest_root_of_base(conversion_return.output_base, output_power);
+                                return (input_point_position * input_power + output_power - 1) / output_power + 1;
+                        }
+                        if (conversion_return.output_base < 2)
+                                return input_point_position + 2;
+                        return static_cast<size_t>(static_cast<double>(input_point_position) * get_log_of_base(conversion_return.input_base) / get_log_of_base(conversion_return.output_base)) + 2;
+                }
+
+                //The number of digits after the point at which the output ends, when the input and output bases are powers of a common root.
+                size_t get_common_root_fraction_length(ConversionReturn &conversion_return)
+                {
+                        size_t input_power;
+                        size_t output_power;
+                        get_smallest_root_of_base(conversion_return.input_base, input_power);
+                        get_smallest_root_of_base(conversion_return.output_base, output_power);
+                        return (get_input_fraction_length() * input_power + output_power - 1) / output_power;
+                }
+
+                //Room to reserve after the integer part: the point, the digits after it and the extra digit kept for rounding. Precision is capped at the length the part after the point has, if it ends.
+                //Bases with a common root are capped at the length their digits are regrouped or sliced to, before trailing zeroes are dropped. With repetend notation there is also room for the prefix and the repetend in brackets, in case the output alphabet does not allow them.
+                size_t estimate_fraction_length(ConversionReturn &conversion_return)
                 {
-                        boost::multiprecision::cpp_int num = convert_number_wstring_to_integer(input_front, input_digits);
-                        conversion_return.before_point = convert_integer_to_wstring(num, conversion_return.output_digits);
-                        trim_zeroes_from_integer(conversion_return);
+                        if (!conversion_return.is_float)
+                                return 0;
+                        size_t length = conversion_return.precision;
+                        size_t terminating_length;
+                        if (do_bases_share_a_common_root(conversion_return))
+                                length = std::min(length, get_common_root_fraction_length(conversion_return));
+                        else if (get_terminating_length(conversion_return.output_base, terminating_length))
+                                length = std::min(length, std::max<size_t>(terminating_length, 1));
+                        size_t prefix_length;
+                        size_t repetend_length;
+                        if (repetend_notation && conversion_return.output_base >= 2 && get_repetend_lengths(conversion_return.output_base, prefix_length, repetend_length))
+                                length = std::max(length, prefix_length + repetend_length + 2);
+                        return length + 2;
+                }
+
+                //Writes the integer part into output_buffer, which is first sized for it and for the fraction after it.
+                //Power-of-two output bases are sliced from the bits of the integer, and bases with the root of shared_integer_digits, if given, are regrouped from those digits, so only other bases need divisions.
+                template <typename CharT>
+                void convert_base_front(ConversionReturn &conversion_return, const Alphabet &output_alphabet, BasicOutputBuffer<CharT> &output_buffer, const SharedIntegerDigits *shared_integer_digits = nullptr)
+                {
+                        size_t fraction_length = estimate_fraction_length(conversion_return);
+                        if (is_bit_slicing_possible(conversion_return))
+                        {
+                                output_buffer.reset(estimate_integer_length(conversion_return), fraction_length);
+                                visit_input_digit_values([&](const auto &digit_values) { write_integer_by_bit_slicing(digit_values, 0, input_point_position, get_bits_per_digit(conversion_return.input_base), output_alphabet, output_buffer); });
+                        }
+                        else if (do_bases_share_a_common_root(conversion_return))
+                        {
+                                size_t input_power;
+                                size_t output_power;
+                                size_t root = get_smallest_root_of_base(conversion_return.input_base, input_power);
+                                get_smallest_root_of_base(conversion_return.output_base, output_power);
+                                output_buffer.reset(estimate_integer_length(conversion_return), fraction_length);
+                                visit_input_digit_values([&](const auto &digit_values) { write_integer_by_regrouping(digit_values, 0, input_point_position, root, input_power, output_power, output_alphabet, output_buffer); });
+                        }
+                        else if (conversion_return.output_base >= 2 && is_input_integer_native())
+                        {
+                                output_buffer.reset(output_alphabet.get_native_digits() + 1, fraction_length);
+                                write_native_integer(get_input_native_integer(), output_alphabet, output_buffer);
+                        }
+                        else if (get_bits_per_digit(conversion_return.output_base) != 0)
+                        {
+                                const std::pmr::vector<size_t> &integer_bits = get_input_integer_bits();
+                                output_buffer.reset(integer_bits.size() * 32 / get_bits_per_digit(conversion_return.output_base) + 2, fraction_length);
+                                write_integer_by_bit_slicing(integer_bits, 0, integer_bits.size(), 32, output_alphabet, output_buffer);
+                        }
+                        else if (shared_integer_digits != nullptr)
+                        {
+                                size_t output_power;
+                                get_smallest_root_of_base(conversion_return.output_base, output_power);
+                                const std::pmr::vector<size_t> &digit_values = shared_integer_digits->digit_values;
+                                output_buffer.reset((digit_values.size() * shared_integer_digits->power + output_power - 1) / output_power + 1, fraction_length);
+                                write_integer_by_regrouping(digit_values, 0, digit_values.size(), shared_integer_digits->root, shared_integer_digits->power, output_power, output_alphabet, output_buffer);
+                        }
+                        else
+                        {
+                                const Integer &num = get_input_integer();
+                                output_buffer.reset(estimate_number_of_digits(num, conversion_return.output_base), fraction_length);
+                                write_integer(num, output_alphabet, output_buffer);
+                        }
+                        trim_zeroes_from_integer(output_alphabet, output_buffer);
                 }
 
-		void convert_base_back(ConversionReturn &conversion_return)
+		template <typename CharT>
+		void convert_base_back(ConversionReturn &conversion_return, const Alphabet &output_alphabet, BasicOutputBuffer<CharT> &output_buffer)
 		{
-                        //Calculate and correct the result.
-                        conversion_return.max_precision = get_max_precision(conversion_return);
-                        if (conversion_return.max_precision < conversion_return.precision)
-                                conversion_return.precision = conversion_return.max_precision;
-                        std::wstring raw_output = calculate_raw_output(conversion_return.precision, conversion_return.output_digits);
-                        conversion_return.after_point = round_output(raw_output, conversion_return.output_digits);
-                        remove_trailing_zeroes(conversion_return);
-
-                        //Determine whether the output is exact.
-                        bool conversion_return_exact = false;
-                        if (test_for_exactness(conversion_return.output, conversion_return.output_digits))
-                                conversion_return_exact = true;
-
-                        //Update conversion_return.
-                        if (!conversion_return_exact)
-                                conversion_return.rounded = true;
-                        else
-                                conversion_return.rounded = false;
-
+                        //Calculate and round the result, which is exact at any precision, so there is no maximum.
+                        //Between bases with a common root the digits are regrouped, with one extra digit to decide the rounding. That is only exact when the output base is even, as in an odd base a tail above one half can start with the digit below the midpoint.
+                        output_buffer.push_point(conversion_return.decimal_point_used);
+                        conversion_return.max_precision = std::numeric_limits<unsigned int>::max();
+                        if (repetend_detection && conversion_return.output_base >= 2 && find_repetend(conversion_return, output_alphabet) && repetend_notation)
+                        {
+                                if (output_alphabet.get_digit_value(L'(') == std::wstring::npos && output_alphabet.get_digit_value(L')') == std::wstring::npos)
+                                {
+                                        write_repetend_notation(conversion_return, output_alphabet, output_buffer);
+                                        return;
+                                }
+                                set_warning(ConversionWarning::repetend_notation_ambiguous, conversion_return);
+                        }
+                        //The output is exact if the part after the point ends within the precision, and the digits end there too.
+                        size_t terminating_length;
+                        bool terminates = get_terminating_length(conversion_return.output_base, terminating_length);
+                        conversion_return.rounded = !terminates || terminating_length > conversion_return.precision;
+                        if (do_bases_share_a_common_root(conversion_return) && conversion_return.output_base % 2 == 0)
+                        {
+                                if (is_bit_slicing_possible(conversion_return))
+                                        calculate_raw_output_by_bit_slicing(conversion_return.precision, output_alphabet, output_buffer);
+                                else
+                                        calculate_raw_output_by_regrouping(conversion_return, output_alphabet, output_buffer);
+                                round_output(output_buffer, output_alphabet);
+                        }
+                        else
+                        {
+                                size_t length = conversion_return.precision;
+                                if (terminates)
+                                        length = std::min(length, std::max<size_t>(terminating_length, 1));
+                                if (calculate_raw_output(length, output_alphabet, output_buffer))
+                                        round_up_output(output_buffer, output_alphabet);
+                        }
+                        remove_trailing_zeroes(output_buffer, output_alphabet);
 		}
+
+                //Appends the prefix and then the repetend in brackets after the point, e.g. 0.1(2497), or a zero digit if the part after the point is zero. The output is exact, so it is not rounded.
+                template <typename CharT>
+                void write_repetend_notation(ConversionReturn &conversion_return, const Alphabet &output_alphabet, BasicOutputBuffer<CharT> &output_buffer)
+                {
+                        for (wchar_t digit : conversion_return.prefix)
+                                output_buffer.push_back(static_cast<CharT>(digit));
+                        if (!conversion_return.repetend.empty())
+                        {
+                                output_buffer.push_back(static_cast<CharT>('('));
+                                for (wchar_t digit : conversion_return.repetend)
+                                        output_buffer.push_back(static_cast<CharT>(digit));
+                                output_buffer.push_back(static_cast<CharT>(')'));
+                        }
+                        if (conversion_return.prefix.empty() && conversion_return.repetend.empty())
+                                output_buffer.push_back(static_cast<CharT>(output_alphabet.get_digit(0)));
+                        conversion_return.rounded = false;
+                }
 
-		unsigned int get_max_precision(ConversionReturn &conversion_return)
-		{
-		        boost::multiprecision::cpp_int size_of_base_10 = exponent(10, 1800); //1800 is the maximum precision of the cpp_dec_float_huge type in base 10.
-                        boost::multiprecision::cpp_int corrected_float_max_precision = 0;
-                        boost::multiprecision::cpp_int size_of_output_base = 1;
-                        unsigned int base = conversion_return.output_base;
-                        while (size_of_output_base * base <= size_of_base_10)
-                        {
-                                corrected_float_max_precision++;
-                                size_of_output_base *= base;
-                        }
-                        unsigned int max_precision = static_cast<unsigned int>(corrected_float_max_precision);
-                        if (precision_requested > corrected_float_max_precision)
-                                set_warning("Float precision at base " + std::to_string(base) + " can be no greater than " + std::to_string(max_precision) + ". Precision has been reset to " + std::to_string(max_precision) + ".", conversion_return);
-                        return max_precision;
-		}
+                //Appends actual_precision digits after the point to output_buffer: the digits of floor(numerator * base^actual_precision / denominator), from one multiplication and one division of integers.
+                //Returns whether the remainder is at least half the denominator, in which case the digits must be rounded up.
+                //Short input fractions are expanded a word of digits at a time by calculate_raw_output_in_chunks, at any precision.
+                //Otherwise the integers are the narrowest type which estimate_fraction_bits shows they fit in: a NativeInteger at usual precisions, a 1024-bit integer on the stack for longer ones, and cpp_int beyond that.
+                template <typename CharT>
+                bool calculate_raw_output(size_t actual_precision, const Alphabet &digits_to, BasicOutputBuffer<CharT> &output_buffer)
+                {
+                        if (digits_to.get_base() >= 2 && estimate_fraction_bits(0, digits_to.get_base()) + 64 <= static_cast<size_t>(std::numeric_limits<NativeInteger>::digits))
+                                return calculate_raw_output_in_chunks(actual_precision, digits_to, output_buffer);
+                        size_t bits = estimate_fraction_bits(actual_precision, digits_to.get_base());
+                        if (bits <= static_cast<size_t>(std::numeric_limits<NativeInteger>::digits))
+                                return calculate_raw_output_in_fixed_width<NativeInteger>(actual_precision, digits_to, output_buffer);
+                        if (bits <= static_cast<size_t>(std::numeric_limits<boost::multiprecision::uint1024_t>::digits))
+                                return calculate_raw_output_in_fixed_width<boost::multiprecision::uint1024_t>(actual_precision, digits_to, output_buffer);
+                        parse_input_fraction();
+                        boost::multiprecision::cpp_int digits = input_fraction_numerator * *PowerCache::instance().get_power(digits_to.get_base(), actual_precision);
+                        boost::multiprecision::cpp_int remainder;
+                        boost::multiprecision::divide_qr(digits, *input_fraction_denominator, digits, remainder);
+                        write_fraction_digits(digits, actual_precision, digits_to, output_buffer);
+                        return 2 * remainder >= *input_fraction_denominator;
+                }
 
-                std::wstring calculate_raw_output(unsigned int actual_precision, std::wstring digits_to)
+                //An upper bound on the bits of numerator * base^actual_precision, and of twice the remainder, from the lengths of the input fraction and of the output. Rounded up by more than the error of the logarithms.
+                size_t estimate_fraction_bits(size_t actual_precision, size_t base)
+                {
+                        double bits = (static_cast<double>(get_input_fraction_length()) * get_log_of_base(input_alphabet.get_base()) + static_cast<double>(actual_precision) * get_log_of_base(base)) / std::log(2.0);
+                        return static_cast<size_t>(bits) + 3;
+                }
+
+                //calculate_raw_output for a denominator small enough that denominator * base^k fits in a NativeInteger, where base^k is the alphabet's word power.
+                //The digits are produced k at a time from the most significant end: the remainder is multiplied by base^k, the quotient by the denominator is the next k digits, expanded in a word, and the remainder carries on. The cost grows linearly with the precision, and stops early if the fraction ends.
+                template <typename CharT>
+                bool calculate_raw_output_in_chunks(size_t actual_precision, const Alphabet &digits_to, BasicOutputBuffer<CharT> &output_buffer)
+                {
+                        NativeInteger denominator = calculate_power<NativeInteger>(input_alphabet.get_base(), get_input_fraction_length());
+                        NativeInteger remainder = visit_input_digit_values([&](const auto &digit_values) { return convert_digit_values_to_native_integer(digit_values, input_point_position, input_digit_count, input_alphabet); });
+                        size_t written { 0 };
+                        while (written < actual_precision)
+                        {
+                                size_t chunk_length = std::min(digits_to.get_word_digits(), actual_precision - written);
+                                std::uint64_t chunk_power = chunk_length == digits_to.get_word_digits() ? digits_to.get_word_power() : calculate_power<std::uint64_t>(digits_to.get_base(), chunk_length);
+                                remainder *= chunk_power;
+                                std::uint64_t chunk = static_cast<std::uint64_t>(remainder / denominator);
+                                remainder -= chunk * denominator;
+                                append_word_digits(chunk, chunk_length, digits_to, output_buffer);
+                                written += chunk_length;
+                                if (remainder == 0) //The rest of the digits are zeroes, which would be removed.
+                                        break;
+                        }
+                        return 2 * remainder >= denominator;
+                }
+
+                //Appends a word below base^length to output_buffer as exactly length digits, including any leading zeroes. The digits are found with the alphabet's WordDivisor.
+                template <typename CharT>
+                void append_word_digits(std::uint64_t word, size_t length, const Alphabet &digits_to, BasicOutputBuffer<CharT> &output_buffer)
+                {
+                        for (size_t i { 0 }; i < length; i++)
+                                output_buffer.push_back(digits_to.get_digit(0));
+                        if (output_buffer.overflowed()) //Caller-owned storage without room for the digits, which the conversion will report.
+                                return;
+                        std::uint64_t base = digits_to.get_base();
+                        const WordDivisor &divisor = digits_to.get_divisor();
+                        CharT *digit = output_buffer.end();
+                        for (size_t i { 0 }; i < length; i++)
+                        {
+                                std::uint64_t quotient = divisor.divide(word);
+                                *--digit = digits_to.get_digit(static_cast<size_t>(word - quotient * base));
+                                word = quotient;
+                        }
+                }
+
+                //calculate_raw_output in a bounded FractionInteger, for fractions which estimate_fraction_bits shows fit in it. The fraction is parsed again each time, as that is cheaper than keeping it, and nothing is allocated.
+                template <typename FractionInteger, typename CharT>
+                bool calculate_raw_output_in_fixed_width(size_t actual_precision, const Alphabet &digits_to, BasicOutputBuffer<CharT> &output_buffer)
+                {
+                        size_t input_base = input_alphabet.get_base();
+                        FractionInteger numerator;
+                        if constexpr (std::is_same<FractionInteger, NativeInteger>::value)
+                                numerator = visit_input_digit_values([&](const auto &digit_values) { return convert_digit_values_to_native_integer(digit_values, input_point_position, input_digit_count, input_alphabet); });
+                        else
+                                numerator = visit_input_digit_values([&](const auto &digit_values) { return convert_digit_values_to_integer<FractionInteger>(digit_values, input_point_position, input_digit_count, input_base); });
+                        FractionInteger denominator = calculate_power<FractionInteger>(input_base, get_input_fraction_length());
+                        FractionInteger digits = numerator * calculate_power<FractionInteger>(digits_to.get_base(), actual_precision);
+                        FractionInteger remainder = digits % denominator;
+                        digits /= denominator;
+                        write_fraction_digits(digits, actual_precision, digits_to, output_buffer);
+                        return 2 * remainder >= denominator;
+                }
+
+                //Appends an integer below base^length to output_buffer as exactly length digits, including any leading zeroes. The digits are written from the back into a window over the end of output_buffer.
+                template <typename FractionInteger, typename CharT>
+                void write_fraction_digits(const FractionInteger &digits, size_t length, const Alphabet &digits_to, BasicOutputBuffer<CharT> &output_buffer)
                 {
-                        size_t digits_in_back = input_back.length();
-			size_t base = input_digits.length();
-			boost::multiprecision::cpp_int denominator = exponent(base, digits_in_back);
-			boost::multiprecision::cpp_int numerator = convert_number_wstring_to_integer(input_back, input_digits);
-			cpp_dec_float_huge numerator_f = static_cast<cpp_dec_float_huge>(numerator);
-			cpp_dec_float_huge denominator_f = static_cast<cpp_dec_float_huge>(denominator);
-			cpp_dec_float_huge fraction = numerator_f / denominator_f;
-			std::string empty_string {""};
-			std::wstring output_string = convert_string_to_wstring(empty_string);
-			size_t position_output { 0 };
-			size_t position_digits;
-			bool last_digit_added = false;
-			base = digits_to.size();
-                        while (position_output <= actual_precision && !last_digit_added) //<= there is one extra digit on the end, to be removed later.
-			{
-				if (fraction == 0)
-					last_digit_added = true;
-				fraction = fraction * base;
-				cpp_dec_float_huge integer;
-				fraction = boost::multiprecision::modf(fraction, &integer);
-				position_digits = static_cast<size_t>(integer);
-				output_string += digits_to[(position_digits)];
-				position_output++;
-			}
-			return output_string;
+                        for (size_t i { 0 }; i < length; i++)
+                                output_buffer.push_back(digits_to.get_digit(0));
+                        if (output_buffer.overflowed()) //Caller-owned storage without room for the digits, which the conversion will report.
+                                return;
+                        BasicOutputBuffer<CharT> fraction_buffer(output_buffer.end() - length, length, length);
+                        if constexpr (std::is_same<FractionInteger, NativeInteger>::value)
+                                write_native_integer(digits, digits_to, fraction_buffer);
+                        else
+                                write_integer(digits, digits_to, fraction_buffer);
+                }
+
+                //Exact equivalent of calculate_raw_output when both bases are powers of two. As there, one digit beyond actual_precision is kept for rounding, and a terminating fraction ends with a single zero digit.
+                template <typename CharT>
+                void calculate_raw_output_by_bit_slicing(unsigned int actual_precision, const Alphabet &digits_to, BasicOutputBuffer<CharT> &output_buffer)
+                {
+                        size_t max_digits = static_cast<size_t>(actual_precision) + 1;
+                        size_t digits_written = visit_input_digit_values([&](const auto &digit_values) { return write_fraction_by_bit_slicing(digit_values, input_point_position, input_digit_count, get_bits_per_digit(input_alphabet.get_base()), digits_to, max_digits, output_buffer); });
+                        if (digits_written < max_digits)
+                                output_buffer.push_back(digits_to.get_digit(0));
+                }
+
+                //Exact equivalent of calculate_raw_output when both bases are powers of a common root, in the same form as calculate_raw_output_by_bit_slicing.
+                template <typename CharT>
+                void calculate_raw_output_by_regrouping(ConversionReturn &conversion_return, const Alphabet &digits_to, BasicOutputBuffer<CharT> &output_buffer)
+                {
+                        size_t input_power;
+                        size_t output_power;
+                        size_t root = get_smallest_root_of_base(conversion_return.input_base, input_power);
+                        get_smallest_root_of_base(conversion_return.output_base, output_power);
+                        size_t max_digits = static_cast<size_t>(conversion_return.precision) + 1;
+                        size_t digits_written = visit_input_digit_values([&](const auto &digit_values) { return write_fraction_by_regrouping(digit_values, input_point_position, input_digit_count, root, input_power, output_power, digits_to, max_digits, output_buffer); });
+                        if (digits_written < max_digits)
+                                output_buffer.push_back(digits_to.get_digit(0));
                 }
 
-                std::wstring round_output(std::wstring raw_output, std::wstring digits_to)
+                //Rounds the digits after the point in place, removing the extra digit. The extra digit rounds up from the midpoint of the base.
+                template <typename CharT>
+                void round_output(BasicOutputBuffer<CharT> &output_buffer, const Alphabet &digits_to)
                 {
-                        bool rounding_needed = true;
-                        bool rounded = false;
-                        unsigned int base = digits_to.length();
-                        boost::multiprecision::cpp_int midpoint_base = base;
-                        if (base % 2 == 1)
-                                midpoint_base++;
-                        boost::multiprecision::cpp_int midpoint = (midpoint_base / 2);
-                        unsigned int position_digits = digits_to.find_first_of(raw_output.back());
-                        if (position_digits < midpoint) //If final digit is below mid point (midpoint variable is the next digit available at or below the true mid point), no need to do further rounding, just remove the final digit.
+                        size_t midpoint = (digits_to.get_base() + 1) / 2;
+                        size_t extra_digit = digits_to.get_digit_value(output_buffer.back());
+                        output_buffer.pop_back();
+                        if (extra_digit >= midpoint)
+                                round_up_output(output_buffer, digits_to);
+                        else if (output_buffer.size() == output_buffer.get_after_point_position()) //A fraction of zero keeps one zero digit after the point.
+                                output_buffer.push_back(digits_to.get_digit(0));
+                }
+
+                //Adds one to the last digit of the output. Highest digits (the equivalent of 9 in decimal) become zero and carry into the digit before them, across the point into the integer part, which gains a digit in front if every digit of it was the highest.
+                template <typename CharT>
+                void round_up_output(BasicOutputBuffer<CharT> &output_buffer, const Alphabet &digits_to)
+                {
+                        size_t highest_digit = digits_to.get_base() - 1;
+                        size_t point_position = output_buffer.get_after_point_position() - 1;
+                        for (size_t position { output_buffer.size() }; position > 0; position--)
                         {
-                                rounding_needed = false;
-                                raw_output = raw_output.substr(0, (raw_output.size() - 1));
-                                rounded = true;
-                        }
-                        else if (raw_output.size() > 1)//If final digit at or above mid point, need to round up.
-                        {
-                                unsigned int position_output = (raw_output.size() - 2);
-                                while (rounding_needed && position_output >= 0) //Keep rounding up as long as the final digit is the last in digits_to (ie is the highest possible digit, the equivalent of 9 in decimal). Do not remove the last digit remaining after the decimal point.
+                                if (position - 1 == point_position)
+                                        continue;
+                                CharT &digit = output_buffer[position - 1];
+                                size_t digit_value = digits_to.get_digit_value(digit);
+                                if (digit_value != highest_digit)
                                 {
-                                        if ((raw_output[position_output + 1] != digits_to.back() || raw_output[position_output] != digits_to.back()) || position_output == 0)
-                                        {
-                                                position_digits = digits_to.find_first_of(raw_output[position_output]);
-                                                position_digits++;
-                                                raw_output[(position_output)] = digits_to[position_digits];
-                                                rounding_needed = false;
-                                                rounded = true;
-                                                raw_output = raw_output.substr(0, (raw_output.size() - 1));
-                                        }
-                                        else
-                                                raw_output = raw_output.substr(0, (raw_output.size() - 1)); //If the final digit in raw_output is the highest digit, remove it.
-
-                                        position_output--;
+                                        digit = digits_to.get_digit(digit_value + 1);
+                                        return;
                                 }
-
+                                digit = digits_to.get_digit(0);
                         }
-                        return raw_output;
+                        output_buffer.push_front(digits_to.get_digit(1));
                 }
 
-                void remove_trailing_zeroes(ConversionReturn &conversion_return)
+                //Drops trailing zero digits after the point, keeping at least one.
+                template <typename CharT>
+                void remove_trailing_zeroes(BasicOutputBuffer<CharT> &output_buffer, const Alphabet &output_alphabet)
                 {
-                        unsigned int position_output = conversion_return.after_point.size();
-                        bool finished {false};
-                        if (position_output > 1)
-                        {
-                                while (position_output > 1 && !finished)
-                                {
-                                        --position_output;
-                                        unsigned int character_position = conversion_return.output_digits.find_first_of(conversion_return.after_point.at(position_output));
-                                        if (character_position != 0)
-                                                finished = true;
-                                        else
-                                                conversion_return.after_point = conversion_return.after_point.substr(0, position_output);
-                                }
-                        }
-		}
-
-		bool test_for_exactness(std::wstring proposed_output, std::wstring output_digits)
-		{
-		        bool exact {false};
-		        unsigned int input_base = input_digits.size();
-		        unsigned int output_base = output_digits.size();
-		        boost::multiprecision::cpp_int common_base = input_base * output_base;
-		        boost::multiprecision::cpp_int revised_output_numerator = convert_number_wstring_to_integer(proposed_output, output_digits) * input_base;
-		        if (revised_output_numerator % output_base == 0)
-                                exact = true;
-                        return exact;
+                        size_t after_point = output_buffer.get_after_point_position();
+                        while (output_buffer.size() - after_point > 1 && output_alphabet.get_digit_value(output_buffer.back()) == 0)
+                                output_buffer.pop_back();
 		}
 
-                void convert_output_digits_to_uppercase(ConversionReturn &conversion_return)
+                template <typename CharT>
+                void convert_output_digits_to_uppercase(BasicOutputBuffer<CharT> &output_buffer)
 		{
-			std::transform(conversion_return.before_point.begin(), conversion_return.before_point.end(), conversion_return.before_point.begin(), ::toupper);
-			std::transform(conversion_return.after_point.begin(), conversion_return.after_point.end(), conversion_return.after_point.begin(), ::toupper);
+			std::transform(output_buffer.begin(), output_buffer.end(), output_buffer.begin(), ::toupper);
 		}
 
-		void set_error_or_warning(std::string &message, std::vector<std::string> &message_vector, bool &encountered)
+		void set_warning(ConversionWarning warning)
 		{
-		        if (!encountered)
-                                message_vector.clear();
-                        encountered = true;
-                        message_vector.push_back(message);
+                        input_warnings.insert(warning);
                         if (use_exceptions)
-				throw (message);
+				throw ConversionException(warning, get_warning_message(warning));
 		}
 
-		void set_warning(std::string warning_message)
+		void set_error(ConversionError error)
 		{
-                        set_error_or_warning(warning_message, input_warnings, input_warnings_encountered);
+                        input_errors.insert(error);
+                        if (use_exceptions)
+				throw ConversionException(error);
 		}
 
-		void set_error(std::string error_message)
+		void set_warning(ConversionWarning warning, ConversionReturn &conversion_return)
 		{
-                        set_error_or_warning(error_message, input_errors, input_errors_encountered);
+                        conversion_return.warnings.insert(warning);
+                        conversion_return.warnings_encountered = true;
+                        if (use_exceptions)
+				throw ConversionException(warning, get_warning_message(warning, conversion_return.output_base));
 		}
 
-		void set_warning(std::string warning_message, ConversionReturn &conversion_return)
+		void set_error(ConversionError error, ConversionReturn &conversion_return)
 		{
-                        set_error_or_warning(warning_message, conversion_return.warnings, conversion_return.warnings_encountered);
-		}
-
-		void set_error(std::string error_message, ConversionReturn &conversion_return)
-		{
-                        set_error_or_warning(error_message, conversion_return.errors, conversion_return.errors_encountered);
-		}
-
-		void set_errors(std::vector<std::string> string_vector)
-		{
-		        for(std::string s : string_vector)
-                                set_error(s);
+                        conversion_return.errors.insert(error);
+                        conversion_return.errors_encountered = true;
+                        if (use_exceptions)
+				throw ConversionException(error);
 		}
 	};
+
+	//The BasicBaseConversion for integers of any size.
+	typedef BasicBaseConversion<boost::multiprecision::cpp_int> BaseConversion;
+
+	//The BasicBaseConversion for integers of any size which allocates everything, including the limbs of its integers, from its memory resource.
+	typedef BasicBaseConversion<pmr_cpp_int> PmrBaseConversion;
+
+        //The digits of a NativeInteger in a defined Base, held without allocation, as returned by encode_native_integer. Long enough for any NativeInteger in binary, and null terminated.
+        struct NativeDigits
+        {
+                char                            characters[sizeof(NativeInteger) * 8 + 1] {};
+                size_t                          length {0};
+
+                constexpr std::string_view view() const
+                {
+                        return std::string_view(characters, length);
+                }
+
+                constexpr const char *c_str() const
+                {
+                        return characters;
+                }
+
+                std::string str() const
+                {
+                        return std::string(characters, length);
+                }
+        };
+
+        //Converts a number in a defined Base to a NativeInteger, or returns false if it has a character which is not a digit or is too large. Nothing is thrown, so it can be tried before another method.
+        //The radix and the digit table are compile-time constants, and the number is only checked for overflow at its last digit, when it has one more digit than always fits.
+        template <Base From>
+        constexpr bool try_convert_to_native_integer(std::string_view number, NativeInteger &num)
+        {
+                constexpr std::uint64_t base = base_information[From].digits.size();
+                constexpr size_t native_digits = get_digits_per_word<NativeInteger>(base);
+                if (number.empty())
+                        return false;
+                size_t first { 0 };
+                while (first + 1 < number.size() && number[first] == base_information[From].digits[0])
+                        first++;
+                if (number.size() - first > native_digits + 1)
+                        return false;
+                num = 0;
+                for (size_t i { first }; i < number.size(); i++)
+                {
+                        std::uint8_t value = defined_base_digit_values[From][static_cast<unsigned char>(number[i])];
+                        if (value == 0xFF)
+                                return false;
+                        if (i - first == native_digits && num > (static_cast<NativeInteger>(~static_cast<NativeInteger>(0)) - value) / base)
+                                return false;
+                        num = num * base + value;
+                }
+                return true;
+        }
+
+        //Converts a number in a defined Base to a NativeInteger. In a constant expression, e.g. through the literals in AnyBaseConversion::literals, a malformed or too large number fails to compile; at run time it throws a ConversionException.
+        template <Base From>
+        constexpr NativeInteger convert_to_native_integer(std::string_view number)
+        {
+                NativeInteger num { 0 };
+                if (!try_convert_to_native_integer<From>(number, num))
+                {
+                        for (char digit : number)
+                        {
+                                if (defined_base_digit_values[From][static_cast<unsigned char>(digit)] == 0xFF)
+                                        throw ConversionException(ConversionError::input_format_invalid);
+                        }
+                        throw ConversionException(number.empty() ? ConversionError::input_format_invalid : ConversionError::input_too_large);
+                }
+                return num;
+        }
+
+        //Writes a NativeInteger in a defined Base. The radix is a compile-time constant, so the compiler divides by it with multiplications. Values above 64 bits are first split into words of get_digits_per_word(base) digits, so the per digit arithmetic is on 64-bit words.
+        template <Base To>
+        constexpr NativeDigits encode_native_integer(NativeInteger num, bool use_uppercase = false)
+        {
+                constexpr std::uint64_t base = base_information[To].digits.size();
+                constexpr size_t word_digits = get_digits_per_word(base);
+                std::uint64_t word_power { 1 };
+                for (size_t i { 0 }; i < word_digits; i++)
+                        word_power *= base;
+                char reversed[sizeof(NativeInteger) * 8] {};
+                size_t length { 0 };
+                while (num > static_cast<std::uint64_t>(~static_cast<std::uint64_t>(0)))
+                {
+                        NativeInteger quotient = num / word_power;
+                        std::uint64_t word = static_cast<std::uint64_t>(num - quotient * word_power);
+                        for (size_t i { 0 }; i < word_digits; i++)
+                        {
+                                reversed[length++] = base_information[To].digits[word % base];
+                                word /= base;
+                        }
+                        num = quotient;
+                }
+                std::uint64_t word = static_cast<std::uint64_t>(num);
+                do
+                {
+                        reversed[length++] = base_information[To].digits[word % base];
+                        word /= base;
+                } while (word != 0);
+                NativeDigits digits {};
+                digits.length = length;
+                for (size_t i { 0 }; i < length; i++)
+                {
+                        char digit = reversed[length - 1 - i];
+                        if (use_uppercase && base_information[To].conversion_to_upper_case && digit >= 'a' && digit <= 'z')
+                                digit = static_cast<char>(digit - 'a' + 'A');
+                        digits.characters[i] = digit;
+                }
+                return digits;
+        }
+
+        //Converts an integer in a defined Base which fits in a NativeInteger to another defined Base, at compile time if the number is a constant. Otherwise as convert_to_native_integer.
+        template <Base From, Base To>
+        constexpr NativeDigits convert_native(std::string_view number, bool use_uppercase = false)
+        {
+                return encode_native_integer<To>(convert_to_native_integer<From>(number), use_uppercase);
+        }
+
+        //Converts a number between two defined Bases, as BaseConversion::output_string but with the bases fixed at compile time. Integers which fit in a NativeInteger are converted with constant radices and digit tables.
+        //Anything else, such as a float or a larger integer, is passed to a BaseConversion. An empty string is returned if the number is malformed.
+        template <Base From, Base To>
+        std::string convert(std::string_view number, bool use_uppercase = false)
+        {
+                NativeInteger num { 0 };
+                if (try_convert_to_native_integer<From>(number, num))
+                        return encode_native_integer<To>(num, use_uppercase).str();
+                return BaseConversion(number, From).output_string(To, use_uppercase);
+        }
+
+        //Literals which give the value of a number in a defined Base as a NativeInteger, calculated at compile time when used in a constant expression. E.g. "zz"_base36 is 1295.
+        namespace literals
+        {
+#define ANYBASECONVERSION_DEFINE_LITERAL(base) \
+                constexpr NativeInteger operator"" _##base(const char *number, size_t length) \
+                { \
+                        return convert_to_native_integer<base>(std::string_view(number, length)); \
+                }
+
+                ANYBASECONVERSION_DEFINE_LITERAL(binary)
+                ANYBASECONVERSION_DEFINE_LITERAL(ternary)
+                ANYBASECONVERSION_DEFINE_LITERAL(quaternary)
+                ANYBASECONVERSION_DEFINE_LITERAL(quinary)
+                ANYBASECONVERSION_DEFINE_LITERAL(senary)
+                ANYBASECONVERSION_DEFINE_LITERAL(septenary)
+                ANYBASECONVERSION_DEFINE_LITERAL(octal)
+                ANYBASECONVERSION_DEFINE_LITERAL(nonary)
+                ANYBASECONVERSION_DEFINE_LITERAL(decimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(undecimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(duodecimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(docenal)
+                ANYBASECONVERSION_DEFINE_LITERAL(tridecimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(tetradecimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(pentadecimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(hexadecimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(vigesimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(tetravigesimal)
+                ANYBASECONVERSION_DEFINE_LITERAL(base32)
+                ANYBASECONVERSION_DEFINE_LITERAL(base36)
+                ANYBASECONVERSION_DEFINE_LITERAL(base58)
+                ANYBASECONVERSION_DEFINE_LITERAL(base64)
+
+#undef ANYBASECONVERSION_DEFINE_LITERAL
+        }
 }
 
 